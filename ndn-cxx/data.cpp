@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,6 +20,8 @@
  */
 
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
+#include "ndn-cxx/impl/peek-name.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 
 namespace ndn {
@@ -46,18 +48,25 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
   //          SignatureValue
   // (elements are encoded in reverse order)
 
+  // elements deferred by wireDecodeLazy() are copied verbatim
+
   size_t totalLength = 0;
 
   // SignatureValue
   if (!wantUnsignedPortionOnly) {
-    if (!m_signatureInfo) {
+    if (!m_signatureInfo && !m_lazySignatureInfo.isValid()) {
       NDN_THROW(Error("Requested wire format, but Data has not been signed"));
     }
     totalLength += prependBlock(encoder, m_signatureValue);
   }
 
   // SignatureInfo
-  totalLength += m_signatureInfo.wireEncode(encoder, SignatureInfo::Type::Data);
+  if (m_lazySignatureInfo.isValid()) {
+    totalLength += prependBlock(encoder, m_lazySignatureInfo);
+  }
+  else {
+    totalLength += m_signatureInfo.wireEncode(encoder, SignatureInfo::Type::Data);
+  }
 
   // Content
   if (hasContent()) {
@@ -65,7 +74,12 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
   }
 
   // MetaInfo
-  totalLength += m_metaInfo.wireEncode(encoder);
+  if (m_lazyMetaInfo.isValid()) {
+    totalLength += prependBlock(encoder, m_lazyMetaInfo);
+  }
+  else {
+    totalLength += m_metaInfo.wireEncode(encoder);
+  }
 
   // Name
   totalLength += m_name.wireEncode(encoder);
@@ -95,33 +109,59 @@ Data::wireEncode(EncodingBuffer& encoder, span<const uint8_t> signature) const
   encoder.prependVarNumber(tlv::Data);
 
   const_cast<Data*>(this)->wireDecode(encoder.block());
+  m_wire.parse();
   return m_wire;
 }
 
 const Block&
 Data::wireEncode() const
 {
-  if (m_wire.hasWire())
+  if (m_wire.hasWire()) {
+    // decoding walks m_wire without parsing it, the sub-elements are created on first request
+    m_wire.parse();
     return m_wire;
+  }
 
   EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
 
+  // the packet retains its encoding, so it is encoded into a buffer of exactly the right size
+  // rather than into a pooled buffer, which can be up to twice as large
   EncodingBuffer buffer(estimatedSize, 0);
   wireEncode(buffer);
 
   const_cast<Data*>(this)->wireDecode(buffer.block());
+  m_wire.parse();
   return m_wire;
 }
 
 void
 Data::wireDecode(const Block& wire)
+{
+  decodeWire(wire, false);
+}
+
+void
+Data::wireDecodeLazy(const Block& wire)
+{
+  decodeWire(wire, true);
+}
+
+span<const uint8_t>
+Data::peekName(span<const uint8_t> wire)
+{
+  return detail::peekName(wire, tlv::Data, "Data");
+}
+
+void
+Data::decodeWire(const Block& wire, bool isLazy)
 {
   if (wire.type() != tlv::Data) {
     NDN_THROW(Error("Data", wire.type()));
   }
-  m_wire = wire;
-  m_wire.parse();
+  // share the buffer of wire, but not its sub-elements (if parsed), which are not needed
+  m_wire = wire.hasWire() ? Block(wire, wire.begin(), wire.end()) : wire;
+  m_wire.encode();
 
   // Data = DATA-TYPE TLV-LENGTH
   //          Name
@@ -130,26 +170,35 @@ Data::wireDecode(const Block& wire)
   //          SignatureInfo
   //          SignatureValue
 
-  auto element = m_wire.elements_begin();
-  if (element == m_wire.elements_end() || element->type() != tlv::Name) {
+  // iterate over a BlockView, so that only the retained elements are turned into Blocks
+  const auto elements = BlockView(m_wire).elements();
+  auto element = elements.begin();
+  if (element == elements.end() || element->type() != tlv::Name) {
     NDN_THROW(Error("Name element is missing or out of order"));
   }
-  m_name.wireDecode(*element);
+  m_name.wireDecode(element->toBlock(m_wire));
 
   m_metaInfo = {};
   m_content = {};
   m_signatureInfo = {};
   m_signatureValue = {};
   m_fullName.clear();
+  m_lazyMetaInfo = {};
+  m_lazySignatureInfo = {};
 
   int lastElement = 1; // last recognized element index, in spec order
-  for (++element; element != m_wire.elements_end(); ++element) {
+  for (++element; element != elements.end(); ++element) {
     switch (element->type()) {
       case tlv::MetaInfo: {
         if (lastElement >= 2) {
           NDN_THROW(Error("MetaInfo element is out of order"));
         }
-        m_metaInfo.wireDecode(*element);
+        if (isLazy) {
+          m_lazyMetaInfo = element->toBlock(m_wire);
+        }
+        else {
+          m_metaInfo.wireDecode(element->toBlock(m_wire));
+        }
         lastElement = 2;
         break;
       }
@@ -157,7 +206,7 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 3) {
           NDN_THROW(Error("Content element is out of order"));
         }
-        m_content = *element;
+        m_content = element->toBlock(m_wire);
         lastElement = 3;
         break;
       }
@@ -165,7 +214,12 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("SignatureInfo element is out of order"));
         }
-        m_signatureInfo.wireDecode(*element);
+        if (isLazy) {
+          m_lazySignatureInfo = element->toBlock(m_wire);
+        }
+        else {
+          m_signatureInfo.wireDecode(element->toBlock(m_wire));
+        }
         lastElement = 4;
         break;
       }
@@ -173,7 +227,7 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 5) {
           NDN_THROW(Error("SignatureValue element is out of order"));
         }
-        m_signatureValue = *element;
+        m_signatureValue = element->toBlock(m_wire);
         lastElement = 5;
         break;
       }
@@ -188,7 +242,7 @@ Data::wireDecode(const Block& wire)
     }
   }
 
-  if (!m_signatureInfo) {
+  if (!m_signatureInfo && !m_lazySignatureInfo.isValid()) {
     NDN_THROW(Error("SignatureInfo element is missing"));
   }
   if (!m_signatureValue.isValid()) {
@@ -196,6 +250,25 @@ Data::wireDecode(const Block& wire)
   }
 }
 
+void
+Data::decodeRemaining()
+{
+  decodeLazyMetaInfo();
+  if (m_lazySignatureInfo.isValid()) {
+    m_signatureInfo.wireDecode(m_lazySignatureInfo);
+    m_lazySignatureInfo = {};
+  }
+}
+
+void
+Data::decodeLazyMetaInfo()
+{
+  if (m_lazyMetaInfo.isValid()) {
+    m_metaInfo.wireDecode(m_lazyMetaInfo);
+    m_lazyMetaInfo = {};
+  }
+}
+
 const Name&
 Data::getFullName() const
 {
@@ -205,6 +278,8 @@ Data::getFullName() const
     }
     m_fullName = m_name;
     m_fullName.appendImplicitSha256Digest(util::Sha256::computeDigest(m_wire));
+    // encode now, so that all copies of the full name share the same wire encoding
+    m_fullName.wireEncode();
   }
 
   return m_fullName;
@@ -231,6 +306,7 @@ Data&
 Data::setMetaInfo(const MetaInfo& metaInfo)
 {
   m_metaInfo = metaInfo;
+  m_lazyMetaInfo = {};
   resetWire();
   return *this;
 }
@@ -295,6 +371,7 @@ Data&
 Data::setSignatureInfo(const SignatureInfo& info)
 {
   m_signatureInfo = info;
+  m_lazySignatureInfo = {};
   resetWire();
   return *this;
 }
@@ -326,9 +403,14 @@ Data::extractSignedRanges() const
   bufs.reserve(1); // One range containing data value up to, but not including, SignatureValue
 
   wireEncode();
-  auto lastSignedIt = std::prev(m_wire.find(tlv::SignatureValue));
-  // Note: we assume that both iterators point to the same underlying buffer
-  bufs.emplace_back(m_wire.value_begin(), lastSignedIt->end());
+  const uint8_t* signedEnd = m_wire.value();
+  for (const auto& element : BlockView(m_wire).elements()) {
+    if (element.type() == tlv::SignatureValue) {
+      break;
+    }
+    signedEnd = element.wire().data() + element.size();
+  }
+  bufs.emplace_back(m_wire.value(), signedEnd);
 
   return bufs;
 }
@@ -336,7 +418,8 @@ Data::extractSignedRanges() const
 Data&
 Data::setContentType(uint32_t type)
 {
-  if (type != m_metaInfo.getType()) {
+  decodeLazyMetaInfo();
+  if (type != getContentType()) {
     m_metaInfo.setType(type);
     resetWire();
   }
@@ -346,7 +429,8 @@ Data::setContentType(uint32_t type)
 Data&
 Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 {
-  if (freshnessPeriod != m_metaInfo.getFreshnessPeriod()) {
+  decodeLazyMetaInfo();
+  if (freshnessPeriod != getFreshnessPeriod()) {
     m_metaInfo.setFreshnessPeriod(freshnessPeriod);
     resetWire();
   }
@@ -356,7 +440,8 @@ Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 Data&
 Data::setFinalBlock(std::optional<name::Component> finalBlockId)
 {
-  if (finalBlockId != m_metaInfo.getFinalBlock()) {
+  decodeLazyMetaInfo();
+  if (finalBlockId != getFinalBlock()) {
     m_metaInfo.setFinalBlock(std::move(finalBlockId));
     resetWire();
   }
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -102,6 +102,7 @@ public:
   /**
    * @brief Encode into a Block.
    * @pre Data must be signed.
+   * @note The encoding of a decoded packet is parsed into sub-elements on the first call.
    */
   const Block&
   wireEncode() const;
@@ -112,6 +113,42 @@ public:
   void
   wireDecode(const Block& wire);
 
+  /**
+   * @brief Decode from @p wire, deferring the decoding of `MetaInfo` and `SignatureInfo`.
+   *
+   * The top-level structure of the packet and the Name are decoded and validated immediately,
+   * while `MetaInfo` and `SignatureInfo` are retained undecoded until decodeRemaining() is called.
+   * This saves their decoding cost if the application only needs the name, the content, or the
+   * wire encoding of the packet. Re-encoding the packet copies the undecoded elements verbatim.
+   *
+   * @throw Error the top-level structure or the Name is invalid
+   * @note The accessors of `MetaInfo` and `SignatureInfo` and their fields, as well as
+   *       comparison and printing of the packet, throw Error until decodeRemaining() is called.
+   */
+  void
+  wireDecodeLazy(const Block& wire);
+
+  /**
+   * @brief Decode the elements that were deferred by wireDecodeLazy().
+   *
+   * This is a no-op if the packet was decoded with wireDecode() or has already been fully decoded.
+   *
+   * @throw tlv::Error `MetaInfo` or `SignatureInfo` is invalid
+   */
+  void
+  decodeRemaining();
+
+  /**
+   * @brief Locate the Name of the %Data packet in @p wire without decoding the packet.
+   * @return the complete Name element, within @p wire
+   * @throw tlv::Error @p wire does not start with a %Data packet, or the packet does not start
+   *                   with a Name element
+   *
+   * Neither the Name nor the remainder of the packet are validated.
+   */
+  static span<const uint8_t>
+  peekName(span<const uint8_t> wire);
+
   /**
    * @brief Check if this instance has cached wire encoding.
    */
@@ -148,10 +185,14 @@ public: // Data fields
 
   /**
    * @brief Get the `MetaInfo` element.
+   * @throw Error The packet was decoded with wireDecodeLazy() and decodeRemaining() was not called.
    */
   const MetaInfo&
-  getMetaInfo() const noexcept
+  getMetaInfo() const
   {
+    if (m_lazyMetaInfo.isValid()) {
+      NDN_THROW(Error("MetaInfo has not been decoded, decodeRemaining() must be called first"));
+    }
     return m_metaInfo;
   }
 
@@ -238,10 +279,14 @@ public: // Data fields
 
   /**
    * @brief Get the `SignatureInfo` element.
+   * @throw Error The packet was decoded with wireDecodeLazy() and decodeRemaining() was not called.
    */
   const SignatureInfo&
-  getSignatureInfo() const noexcept
+  getSignatureInfo() const
   {
+    if (m_lazySignatureInfo.isValid()) {
+      NDN_THROW(Error("SignatureInfo has not been decoded, decodeRemaining() must be called first"));
+    }
     return m_signatureInfo;
   }
 
@@ -309,9 +354,9 @@ public: // MetaInfo fields
    * @copydoc MetaInfo::getType()
    */
   uint32_t
-  getContentType() const noexcept
+  getContentType() const
   {
-    return m_metaInfo.getType();
+    return getMetaInfo().getType();
   }
 
   /**
@@ -324,9 +369,9 @@ public: // MetaInfo fields
    * @copydoc MetaInfo::getFreshnessPeriod()
    */
   time::milliseconds
-  getFreshnessPeriod() const noexcept
+  getFreshnessPeriod() const
   {
-    return m_metaInfo.getFreshnessPeriod();
+    return getMetaInfo().getFreshnessPeriod();
   }
 
   /**
@@ -339,9 +384,9 @@ public: // MetaInfo fields
    * @copydoc MetaInfo::getFinalBlock()
    */
   const std::optional<name::Component>&
-  getFinalBlock() const noexcept
+  getFinalBlock() const
   {
-    return m_metaInfo.getFinalBlock();
+    return getMetaInfo().getFinalBlock();
   }
 
   /**
@@ -355,19 +400,20 @@ public: // SignatureInfo fields
    * @copydoc SignatureInfo::getSignatureType()
    */
   int32_t
-  getSignatureType() const noexcept
+  getSignatureType() const
   {
-    return m_signatureInfo.getSignatureType();
+    return getSignatureInfo().getSignatureType();
   }
 
   /**
    * @brief Get the `KeyLocator` element.
    */
   std::optional<KeyLocator>
-  getKeyLocator() const noexcept
+  getKeyLocator() const
   {
-    if (m_signatureInfo.hasKeyLocator()) {
-      return m_signatureInfo.getKeyLocator();
+    const auto& sigInfo = getSignatureInfo();
+    if (sigInfo.hasKeyLocator()) {
+      return sigInfo.getKeyLocator();
     }
     return std::nullopt;
   }
@@ -380,6 +426,13 @@ protected:
   void
   resetWire();
 
+private:
+  void
+  decodeWire(const Block& wire, bool isLazy);
+
+  void
+  decodeLazyMetaInfo();
+
 private:
   Name m_name;
   MetaInfo m_metaInfo;
@@ -389,6 +442,10 @@ private:
 
   mutable Block m_wire;
   mutable Name m_fullName; // cached FullName computed from m_wire
+
+  // elements not yet decoded after wireDecodeLazy(), invalid if already decoded
+  Block m_lazyMetaInfo;
+  Block m_lazySignatureInfo;
 };
 
 #ifndef DOXYGEN
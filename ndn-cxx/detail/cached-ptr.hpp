@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_CACHED_PTR_HPP
+#define NDN_CXX_DETAIL_CACHED_PTR_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <atomic>
+
+namespace ndn::detail {
+
+/**
+ * @brief A lazily computed, shared, immutable value that can be published from const members.
+ *
+ * Non-const members (set(), reset(), assignment) require exclusive access, like any other
+ * modification of the owning object. get() and publish() may be called concurrently from
+ * multiple threads: the first value passed to publish() wins, and every caller observes it.
+ */
+template<typename T>
+class CachedPtr
+{
+public:
+  CachedPtr() noexcept = default;
+
+  CachedPtr(const CachedPtr& other) noexcept
+  {
+    *this = other;
+  }
+
+  CachedPtr(CachedPtr&& other) noexcept
+    : m_owner(std::move(other.m_owner))
+    , m_ptr(other.m_ptr.exchange(nullptr, std::memory_order_relaxed))
+  {
+  }
+
+  CachedPtr&
+  operator=(const CachedPtr& other) noexcept
+  {
+    if (this != &other) {
+      set(other.load());
+    }
+    return *this;
+  }
+
+  CachedPtr&
+  operator=(CachedPtr&& other) noexcept
+  {
+    if (this != &other) {
+      m_owner = std::move(other.m_owner);
+      m_ptr.store(other.m_ptr.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Return the cached value, or nullptr if none has been published.
+   */
+  const T*
+  get() const noexcept
+  {
+    return m_ptr.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Publish @p value unless another value was published first.
+   * @return The value that is cached after the call.
+   */
+  const T&
+  publish(shared_ptr<const T> value) const noexcept
+  {
+    BOOST_ASSERT(value != nullptr);
+    shared_ptr<const T> expected;
+    if (std::atomic_compare_exchange_strong(&m_owner, &expected, value)) {
+      m_ptr.store(value.get(), std::memory_order_release);
+      return *value;
+    }
+    // another thread won the race; its m_ptr store may not be visible yet
+    return *expected;
+  }
+
+  /**
+   * @brief Replace the cached value; requires exclusive access.
+   */
+  void
+  set(shared_ptr<const T> value) noexcept
+  {
+    m_ptr.store(value.get(), std::memory_order_relaxed);
+    m_owner = std::move(value);
+  }
+
+  /**
+   * @brief Drop the cached value; requires exclusive access.
+   */
+  void
+  reset() noexcept
+  {
+    m_ptr.store(nullptr, std::memory_order_relaxed);
+    m_owner.reset();
+  }
+
+private:
+  shared_ptr<const T>
+  load() const noexcept
+  {
+    return get() == nullptr ? nullptr : std::atomic_load(&m_owner);
+  }
+
+private:
+  mutable shared_ptr<const T> m_owner;
+  mutable std::atomic<const T*> m_ptr{nullptr};
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_DETAIL_CACHED_PTR_HPP
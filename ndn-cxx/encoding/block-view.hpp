@@ -0,0 +1,301 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+#define NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+#include <iterator>
+
+namespace ndn {
+
+/**
+ * @brief Non-owning view of an encoded TLV element.
+ *
+ * Unlike Block, a BlockView neither shares ownership of the underlying buffer nor stores its
+ * sub-elements, so creating, copying, and iterating over BlockView instances never allocates
+ * memory or touches a reference count. Sub-elements are located on the fly while iterating
+ * over elements(). The underlying buffer must outlive the view and everything derived from it.
+ *
+ * BlockView is meant for decoders that walk an encoding once; use toBlock() to obtain a Block
+ * for the sub-elements that need to be retained.
+ */
+class BlockView
+{
+public:
+  class Elements;
+
+  /**
+   * @brief Create an invalid view.
+   */
+  BlockView() noexcept = default;
+
+  /**
+   * @brief Create a view of the TLV element at the beginning of @p wire.
+   *
+   * Bytes of @p wire after the end of that element are not part of the view.
+   * @throw tlv::Error @p wire does not begin with a complete TLV element
+   */
+  explicit
+  BlockView(span<const uint8_t> wire)
+  {
+    const uint8_t* pos = wire.data();
+    const uint8_t* end = pos + wire.size();
+    m_type = tlv::readType(pos, end);
+    uint64_t length = tlv::readVarNumber(pos, end);
+    if (length > static_cast<uint64_t>(end - pos)) {
+      NDN_THROW(Block::Error("Not enough bytes in the buffer to fully parse TLV"));
+    }
+    m_wire = {wire.data(), static_cast<size_t>(pos + length - wire.data())};
+    m_value = {pos, static_cast<size_t>(length)};
+  }
+
+  /**
+   * @brief Create a view of the wire encoding of @p block.
+   * @pre `block.hasWire() == true`
+   */
+  explicit
+  BlockView(const Block& block) noexcept
+    : m_wire(block.data(), block.size())
+    , m_value(block.value(), block.value_size())
+    , m_type(block.type())
+  {
+  }
+
+  /**
+   * @brief Check if the view refers to a TLV element.
+   */
+  bool
+  isValid() const noexcept
+  {
+    return m_type != tlv::Invalid;
+  }
+
+  /**
+   * @brief Return the TLV-TYPE of the element.
+   */
+  uint32_t
+  type() const noexcept
+  {
+    return m_type;
+  }
+
+  /**
+   * @brief Return the complete TLV encoding of the element.
+   */
+  span<const uint8_t>
+  wire() const noexcept
+  {
+    return m_wire;
+  }
+
+  /**
+   * @brief Return the size of the complete TLV encoding of the element.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_wire.size();
+  }
+
+  /**
+   * @brief Return the TLV-VALUE of the element.
+   */
+  span<const uint8_t>
+  value() const noexcept
+  {
+    return m_value;
+  }
+
+  /**
+   * @brief Return the TLV-LENGTH of the element.
+   */
+  size_t
+  value_size() const noexcept
+  {
+    return m_value.size();
+  }
+
+  /**
+   * @brief Return the sub-elements contained in the TLV-VALUE.
+   */
+  Elements
+  elements() const noexcept;
+
+  /**
+   * @brief Create a Block for this element that shares the buffer of @p parent.
+   * @pre The view refers to bytes within `parent.wire()`.
+   */
+  Block
+  toBlock(const Block& parent) const
+  {
+    auto begin = parent.begin() + (m_wire.data() - parent.data());
+    return Block(parent, begin, begin + static_cast<ptrdiff_t>(m_wire.size()));
+  }
+
+private:
+  BlockView(uint32_t type, span<const uint8_t> wire, span<const uint8_t> value) noexcept
+    : m_wire(wire)
+    , m_value(value)
+    , m_type(type)
+  {
+  }
+
+private:
+  span<const uint8_t> m_wire;
+  span<const uint8_t> m_value;
+  uint32_t m_type = tlv::Invalid;
+};
+
+/**
+ * @brief Forward range over the TLV elements stored back to back in a sequence of bytes.
+ *
+ * The header of each element is decoded when the iterator reaches it. Incrementing an iterator,
+ * or calling begin(), throws Block::Error if the next element is malformed or extends past the
+ * end of the sequence.
+ */
+class BlockView::Elements
+{
+public:
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = BlockView;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const BlockView*;
+    using reference         = const BlockView&;
+
+    const_iterator() noexcept = default;
+
+    reference
+    operator*() const noexcept
+    {
+      return m_element;
+    }
+
+    pointer
+    operator->() const noexcept
+    {
+      return &m_element;
+    }
+
+    const_iterator&
+    operator++()
+    {
+      load(m_pos + m_element.size());
+      return *this;
+    }
+
+    const_iterator
+    operator++(int)
+    {
+      const_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend bool
+    operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+    {
+      return lhs.m_pos == rhs.m_pos;
+    }
+
+    friend bool
+    operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept
+    {
+      return lhs.m_pos != rhs.m_pos;
+    }
+
+  private:
+    const_iterator(const uint8_t* pos, const uint8_t* end)
+      : m_end(end)
+    {
+      load(pos);
+    }
+
+    void
+    load(const uint8_t* pos)
+    {
+      m_pos = pos;
+      if (pos == m_end) {
+        m_element = {};
+        return;
+      }
+
+      uint32_t type = tlv::readType(pos, m_end);
+      uint64_t length = tlv::readVarNumber(pos, m_end);
+      if (length > static_cast<uint64_t>(m_end - pos)) {
+        NDN_THROW(Block::Error("TLV-LENGTH of sub-element of type " + to_string(type) +
+                               " exceeds TLV-VALUE boundary of parent block"));
+      }
+      size_t headerSize = static_cast<size_t>(pos - m_pos);
+      m_element = BlockView(type, {m_pos, headerSize + static_cast<size_t>(length)},
+                            {pos, static_cast<size_t>(length)});
+    }
+
+  private:
+    BlockView m_element;
+    const uint8_t* m_pos = nullptr;
+    const uint8_t* m_end = nullptr;
+
+    friend Elements;
+  };
+
+  using iterator = const_iterator;
+
+  /**
+   * @brief Create a range over the TLV elements in @p bytes.
+   */
+  explicit
+  Elements(span<const uint8_t> bytes) noexcept
+    : m_bytes(bytes)
+  {
+  }
+
+  const_iterator
+  begin() const
+  {
+    return {m_bytes.data(), m_bytes.data() + m_bytes.size()};
+  }
+
+  const_iterator
+  end() const noexcept
+  {
+    const_iterator it;
+    it.m_pos = it.m_end = m_bytes.data() + m_bytes.size();
+    return it;
+  }
+
+private:
+  span<const uint8_t> m_bytes;
+};
+
+inline BlockView::Elements
+BlockView::elements() const noexcept
+{
+  return Elements(m_value);
+}
+
+} // namespace ndn
+
+#endif // NDN_CXX_ENCODING_BLOCK_VIEW_HPP
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/buffer-pool.hpp"
+
+#include <atomic>
+
+namespace ndn::encoding {
+
+struct BufferPool::Slot
+{
+  explicit
+  Slot(size_t size)
+    : buffer(size)
+  {
+  }
+
+  Buffer buffer;
+  std::atomic<bool> isInUse{false};
+};
+
+// Hand out the buffer of slot through a new control block, whose deleter releases the slot.
+// Unlike checking the reference count of a shared buffer, this cannot be defeated by weak_ptrs.
+// The deleter shares ownership of the slot, so the buffer outlives the pool if necessary.
+shared_ptr<Buffer>
+BufferPool::lend(const shared_ptr<Slot>& slot)
+{
+  slot->isInUse.store(true, std::memory_order_relaxed);
+  return shared_ptr<Buffer>(&slot->buffer, [slot] (Buffer*) {
+    slot->isInUse.store(false, std::memory_order_release);
+  });
+}
+
+BufferPool::BufferPool(size_t maxBuffersPerClass)
+  : m_maxBuffersPerClass(maxBuffersPerClass)
+{
+}
+
+BufferPool::~BufferPool() = default;
+
+shared_ptr<Buffer>
+BufferPool::allocate(size_t size)
+{
+  if (size > MAX_BUFFER_SIZE) {
+    return make_shared<Buffer>(size);
+  }
+
+  size_t index = 0;
+  size_t classSize = MIN_BUFFER_SIZE;
+  while (classSize < size) {
+    classSize <<= 1;
+    ++index;
+  }
+  auto& sc = m_classes[index];
+
+  for (size_t i = 0, n = sc.slots.size(); i < n; ++i) {
+    size_t pos = (sc.next + i) % n;
+    // acquire: the last reference may have been released by another thread
+    if (!sc.slots[pos]->isInUse.load(std::memory_order_acquire)) {
+      sc.next = (pos + 1) % n;
+      return lend(sc.slots[pos]);
+    }
+  }
+
+  if (sc.slots.size() >= m_maxBuffersPerClass) {
+    return make_shared<Buffer>(size);
+  }
+  sc.slots.push_back(make_shared<Slot>(classSize));
+  return lend(sc.slots.back());
+}
+
+size_t
+BufferPool::size() const noexcept
+{
+  size_t n = 0;
+  for (const auto& sc : m_classes) {
+    n += sc.slots.size();
+  }
+  return n;
+}
+
+BufferPool&
+BufferPool::getThreadLocal()
+{
+  static thread_local BufferPool pool;
+  return pool;
+}
+
+} // namespace ndn::encoding
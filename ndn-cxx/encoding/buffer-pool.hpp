@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_BUFFER_POOL_HPP
+#define NDN_CXX_ENCODING_BUFFER_POOL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/encoding/buffer.hpp"
+
+#include <array>
+
+namespace ndn::encoding {
+
+/**
+ * @brief A pool of recyclable buffers for TLV encoding.
+ *
+ * Buffers are grouped into power-of-two size classes from MIN_BUFFER_SIZE to MAX_BUFFER_SIZE.
+ * The pool owns every buffer it has created, and hands it out through a `shared_ptr` with its
+ * own control block; a buffer is recycled as soon as all references to it (e.g., from Block
+ * instances that point into it) have been released. Therefore, in steady state, encoding a
+ * packet whose wire encoding is dropped before the next one is encoded neither allocates nor
+ * clears a buffer; only the small control block of the handed-out `shared_ptr` is allocated.
+ * A `weak_ptr` to a handed-out buffer expires when the buffer is recycled.
+ *
+ * A buffer obtained from the pool can be larger than requested. Its previous contents are
+ * left in place and must not be relied upon. Since the buffer is retained for as long as
+ * it is referenced, objects that keep an encoding for a long time should not hold on to
+ * a pooled buffer that is much larger than the encoding.
+ *
+ * @note This class is not thread-safe, but a buffer may be released from any thread.
+ */
+class BufferPool : noncopyable
+{
+public:
+  static constexpr size_t MIN_BUFFER_SIZE = 64;
+  static constexpr size_t MAX_BUFFER_SIZE = 16384;
+
+  /**
+   * @brief Create a pool.
+   * @param maxBuffersPerClass maximum number of buffers retained in each size class
+   */
+  explicit
+  BufferPool(size_t maxBuffersPerClass = 32);
+
+  ~BufferPool();
+
+  /**
+   * @brief Obtain a buffer of at least @p size bytes.
+   *
+   * If @p size exceeds MAX_BUFFER_SIZE, or all buffers of its size class are in use and the
+   * class is full, a new buffer of exactly @p size bytes is returned that is not retained
+   * by the pool.
+   */
+  shared_ptr<Buffer>
+  allocate(size_t size);
+
+  /**
+   * @brief Return the number of buffers retained by the pool, whether in use or not.
+   */
+  size_t
+  size() const noexcept;
+
+  /**
+   * @brief Return the pool of the calling thread.
+   */
+  static BufferPool&
+  getThreadLocal();
+
+private:
+  static constexpr size_t N_SIZE_CLASSES = 9;
+  static_assert(MIN_BUFFER_SIZE << (N_SIZE_CLASSES - 1) == MAX_BUFFER_SIZE);
+
+  struct Slot;
+
+  struct SizeClass
+  {
+    std::vector<shared_ptr<Slot>> slots;
+    size_t next = 0; ///< index at which the next search for a free buffer begins
+  };
+
+  static shared_ptr<Buffer>
+  lend(const shared_ptr<Slot>& slot);
+
+  std::array<SizeClass, N_SIZE_CLASSES> m_classes;
+  size_t m_maxBuffersPerClass;
+};
+
+} // namespace ndn::encoding
+
+#endif // NDN_CXX_ENCODING_BUFFER_POOL_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -23,6 +23,7 @@
 #define NDN_CXX_ENCODING_ENCODER_HPP
 
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/buffer-pool.hpp"
 
 #include <algorithm>
 
@@ -105,6 +106,15 @@ public: // unique interface to the Encoder
   explicit
   Encoder(size_t totalReserve = MAX_NDN_PACKET_SIZE, size_t reserveFromBack = 400);
 
+  /**
+   * @brief Create instance of the encoder that obtains its buffers from @p pool
+   * @param pool            pool that provides the initial buffer and any reallocation
+   * @param totalReserve    minimum initial buffer size to reserve
+   * @param reserveFromBack number of bytes to reserve for append* operations
+   * @note The underlying buffer can be larger than @p totalReserve.
+   */
+  Encoder(BufferPool& pool, size_t totalReserve, size_t reserveFromBack);
+
   /**
    * @brief Create EncodingBlock from existing block
    *
@@ -124,7 +134,8 @@ public: // unique interface to the Encoder
    * @param addInFront if true, then @p size bytes will be available in front (i.e., subsequent call
    *        to prepend* will not need to allocate memory).  If false, then reservation will be done
    *        at the end of the buffer (i.d., for subsequent append* calls)
-   * @note Reserve size is exact, unlike reserveFront and reserveBack methods
+   * @note Reserve size is exact, unlike reserveFront and reserveBack methods, unless the
+   *       encoder obtains its buffers from a BufferPool
    * @sa reserveFront, reserveBack
    */
   void
@@ -238,8 +249,13 @@ public: // accessors
   Block
   block(bool verifyLength = true) const;
 
+private:
+  shared_ptr<Buffer>
+  allocateBuffer(size_t size) const;
+
 private:
   shared_ptr<Buffer> m_buffer;
+  BufferPool* m_pool = nullptr;
 
   // invariant: m_begin always points to the position of last-written byte (if prepending data)
   iterator m_begin;
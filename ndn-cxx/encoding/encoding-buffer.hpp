@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -41,6 +41,11 @@ public:
   {
   }
 
+  EncodingImpl(BufferPool& pool, size_t totalReserve, size_t reserveFromBack)
+    : Encoder(pool, totalReserve, reserveFromBack)
+  {
+  }
+
   explicit
   EncodingImpl(const Block& block)
     : Encoder(block)
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -35,6 +35,17 @@ enum : uint32_t {
   EncryptedKey = 129,
 };
 
+/**
+ * @brief TLV-TYPE numbers for MerkleAuditPath and related elements.
+ * @sa <a href="../specs/merkle-signature.html">Merkle Batch Signature</a>
+ */
+enum : uint32_t {
+  MerkleAuditPath = 1800,
+  MerkleLeafIndex = 1802,
+  MerkleLeafCount = 1804,
+  MerkleSibling = 1806,
+};
+
 } // namespace ndn::tlv::security
 
 #endif // NDN_CXX_ENCODING_TLV_SECURITY_HPP
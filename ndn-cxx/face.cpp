@@ -25,6 +25,9 @@
 #include "ndn-cxx/impl/face-impl.hpp"
 #include "ndn-cxx/net/face-uri.hpp"
 #include "ndn-cxx/transport/tcp-transport.hpp"
+#ifdef NDN_CXX_HAVE_MEMFD
+#include "ndn-cxx/transport/shm-transport.hpp"
+#endif
 #include "ndn-cxx/transport/unix-transport.hpp"
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/scope.hpp"
@@ -114,6 +117,11 @@ makeDefaultTransport()
     else if (protocol == "tcp" || protocol == "tcp4" || protocol == "tcp6") {
       return TcpTransport::create(transportUri);
     }
+#ifdef NDN_CXX_HAVE_MEMFD
+    else if (protocol == "shm") {
+      return ShmTransport::create(transportUri);
+    }
+#endif
     else {
       NDN_THROW(ConfigFile::Error("Unsupported transport protocol \"" + protocol + "\""));
     }
@@ -310,11 +318,15 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
 void
 Face::onReceiveElement(const Block& blockFromDaemon)
 {
-  lp::Packet lpPacket(blockFromDaemon); // bare Interest/Data is a valid lp::Packet,
-                                        // no need to distinguish
-
-  auto frag = lpPacket.get<lp::FragmentField>();
-  Block netPacket({frag.first, frag.second});
+  // The network packet shares the underlying buffer of the received element. A bare
+  // Interest/Data is used as is, because wrapping it in an lp::Packet would copy it.
+  lp::Packet lpPacket;
+  Block netPacket = blockFromDaemon;
+  if (blockFromDaemon.type() != tlv::Interest && blockFromDaemon.type() != tlv::Data) {
+    lpPacket.wireDecode(blockFromDaemon);
+    auto frag = lpPacket.get<lp::FragmentField>();
+    netPacket = Block(blockFromDaemon, frag.first, frag.second);
+  }
   switch (netPacket.type()) {
     case tlv::Interest: {
       auto interest = make_shared<Interest>(netPacket);
@@ -134,7 +134,8 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    // only Interests whose name is a prefix of the Data name, or the Data full name, can match
+    m_pendingInterestTable.removeIfPrefixOf(data.getName(), true, [&] (PendingInterest& entry) {
       if (!entry.getInterest()->matchesData(data)) {
         return false;
       }
@@ -162,7 +163,7 @@ public: // consumer
   nackPendingInterests(const lp::Nack& nack)
   {
     std::optional<lp::Nack> outNack;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    m_pendingInterestTable.removeIfNameEquals(nack.getInterest().getName(), [&] (PendingInterest& entry) {
       if (!nack.getInterest().matchesInterest(*entry.getInterest())) {
         return false;
       }
@@ -353,7 +354,8 @@ private:
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
-    m_interestFilterTable.forEach([&] (const InterestFilterRecord& filter) {
+    // only filters whose prefix is a prefix of the Interest name can match
+    m_interestFilterTable.forEachPrefixOf(interest.getName(), [&] (const InterestFilterRecord& filter) {
       if (!filter.doesMatch(entry)) {
         return;
       }
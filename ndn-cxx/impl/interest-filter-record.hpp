@@ -51,6 +51,17 @@ public:
     return m_filter;
   }
 
+  /**
+   * @brief Name under which this record is indexed in the InterestFilter table.
+   *
+   * This is the filter prefix; the regular expression, if any, is checked by doesMatch().
+   */
+  const Name&
+  getIndexedName() const
+  {
+    return m_filter.getPrefix();
+  }
+
   /**
    * @brief Check if Interest name matches the filter.
    * @param name Interest Name
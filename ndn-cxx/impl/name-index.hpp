@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_NAME_INDEX_HPP
+#define NDN_CXX_IMPL_NAME_INDEX_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace ndn::detail {
+
+using RecordId = uint64_t;
+
+/**
+ * @brief Name-prefix tree that maps names to the IDs of records stored under them.
+ *
+ * Each node of the tree corresponds to a name component. Looking up the records whose
+ * name is a prefix of a given name costs one child lookup per component of that name,
+ * regardless of how many records are stored in the index.
+ *
+ * The children are keyed by the encoding of their component, which is walked in the wire
+ * encoding of the name with BlockView, so that no Component objects are created. Since the
+ * encoding is canonical, the byte order of the keys is the canonical order of the components.
+ */
+class NameIndex : noncopyable
+{
+public:
+  /**
+   * @brief Associate @p id with @p name.
+   */
+  void
+  insert(const Name& name, RecordId id)
+  {
+    Node* node = &m_root;
+    for (const auto& comp : components(name)) {
+      auto it = node->children.find(key(comp));
+      if (it == node->children.end()) {
+        it = node->children.emplace(std::string(key(comp)), make_unique<Node>()).first;
+      }
+      node = it->second.get();
+    }
+    node->ids.push_back(id);
+  }
+
+  /**
+   * @brief Remove the association between @p id and @p name.
+   *
+   * Nodes that no longer carry any record are pruned from the tree.
+   */
+  void
+  erase(const Name& name, RecordId id)
+  {
+    std::vector<std::pair<Node*, Node::Children::iterator>> path;
+    path.reserve(name.size());
+
+    Node* node = &m_root;
+    for (const auto& comp : components(name)) {
+      auto it = node->children.find(key(comp));
+      if (it == node->children.end()) {
+        return;
+      }
+      path.emplace_back(node, it);
+      node = it->second.get();
+    }
+
+    auto idIt = std::find(node->ids.begin(), node->ids.end(), id);
+    if (idIt == node->ids.end()) {
+      return;
+    }
+    node->ids.erase(idIt);
+
+    for (auto i = path.rbegin(); i != path.rend(); ++i) {
+      const Node& child = *i->second->second;
+      if (!child.ids.empty() || !child.children.empty()) {
+        break;
+      }
+      i->first->children.erase(i->second);
+    }
+  }
+
+  void
+  clear()
+  {
+    m_root.ids.clear();
+    m_root.children.clear();
+  }
+
+  /**
+   * @brief Append to @p ids the records whose name is a prefix of, or equal to, @p name.
+   * @param includeImplicitDigest also append the records whose name is @p name followed by
+   *                              an ImplicitSha256DigestComponent
+   */
+  void
+  findPrefixesOf(const Name& name, bool includeImplicitDigest, std::vector<RecordId>& ids) const
+  {
+    const Node* node = &m_root;
+    ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+    for (const auto& comp : components(name)) {
+      auto it = node->children.find(key(comp));
+      if (it == node->children.end()) {
+        return;
+      }
+      node = it->second.get();
+      ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+    }
+
+    if (includeImplicitDigest) {
+      // ImplicitSha256DigestComponent has the lowest TLV-TYPE, so these children sort first
+      for (const auto& [encoding, child] : node->children) {
+        if (static_cast<uint8_t>(encoding.front()) != tlv::ImplicitSha256DigestComponent) {
+          break;
+        }
+        ids.insert(ids.end(), child->ids.begin(), child->ids.end());
+      }
+    }
+  }
+
+  /**
+   * @brief Append to @p ids the records whose name equals @p name.
+   */
+  void
+  findExact(const Name& name, std::vector<RecordId>& ids) const
+  {
+    const Node* node = &m_root;
+    for (const auto& comp : components(name)) {
+      auto it = node->children.find(key(comp));
+      if (it == node->children.end()) {
+        return;
+      }
+      node = it->second.get();
+    }
+    ids.insert(ids.end(), node->ids.begin(), node->ids.end());
+  }
+
+private:
+  static BlockView::Elements
+  components(const Name& name)
+  {
+    return BlockView(name.wireEncode()).elements();
+  }
+
+  static std::string_view
+  key(const BlockView& comp) noexcept
+  {
+    return {reinterpret_cast<const char*>(comp.wire().data()), comp.wire().size()};
+  }
+
+  struct Node
+  {
+    // keyed by the canonical TLV encoding of the component
+    using Children = std::map<std::string, unique_ptr<Node>, std::less<>>;
+
+    Children children;
+    std::vector<RecordId> ids;
+  };
+
+  Node m_root;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_IMPL_NAME_INDEX_HPP
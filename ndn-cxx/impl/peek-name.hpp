@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_PEEK_NAME_HPP
+#define NDN_CXX_IMPL_PEEK_NAME_HPP
+
+#include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+namespace ndn::detail {
+
+/**
+ * \brief Locate the Name element that must be the first element of an Interest or Data.
+ * \param wire encoded packet
+ * \param packetType expected TLV-TYPE of the packet
+ * \param packetTypeName name of the packet type, used in error messages
+ * \return the complete Name TLV, within \p wire
+ * \throw tlv::Error \p wire does not start with a packet of type \p packetType whose first
+ *                   element is a Name, or either TLV is truncated
+ *
+ * Only the TLV-TYPE and TLV-LENGTH of the packet and of the Name are read.
+ */
+inline span<const uint8_t>
+peekName(span<const uint8_t> wire, uint32_t packetType, const char* packetTypeName)
+{
+  const uint8_t* pos = wire.data();
+  const uint8_t* end = pos + wire.size();
+
+  uint32_t type = tlv::readType(pos, end);
+  if (type != packetType) {
+    NDN_THROW(tlv::Error(packetTypeName, type));
+  }
+  uint64_t length = tlv::readVarNumber(pos, end);
+  if (length > static_cast<uint64_t>(end - pos)) {
+    NDN_THROW(tlv::Error("Packet TLV-LENGTH exceeds buffer size"));
+  }
+  end = pos + length;
+
+  const uint8_t* nameBegin = pos;
+  if (pos == end || tlv::readType(pos, end) != tlv::Name) {
+    NDN_THROW(tlv::Error("Name element is missing or out of order"));
+  }
+  uint64_t nameLength = tlv::readVarNumber(pos, end);
+  if (nameLength > static_cast<uint64_t>(end - pos)) {
+    NDN_THROW(tlv::Error("Name TLV-LENGTH exceeds packet size"));
+  }
+  return {nameBegin, static_cast<size_t>(pos + nameLength - nameBegin)};
+}
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_IMPL_PEEK_NAME_HPP
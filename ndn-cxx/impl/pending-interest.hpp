@@ -92,6 +92,15 @@ public:
     return m_interest;
   }
 
+  /**
+   * @brief Name under which this record is indexed in the pending Interest table.
+   */
+  const Name&
+  getIndexedName() const
+  {
+    return m_interest->getName();
+  }
+
   PendingInterestOrigin
   getOrigin() const
   {
@@ -22,18 +22,25 @@
 #ifndef NDN_CXX_IMPL_RECORD_CONTAINER_HPP
 #define NDN_CXX_IMPL_RECORD_CONTAINER_HPP
 
-#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/impl/name-index.hpp"
 #include "ndn-cxx/util/signal/signal.hpp"
 
+#include <algorithm>
 #include <atomic>
 
 namespace ndn::detail {
 
-using RecordId = uint64_t;
-
 template<typename T>
 class RecordContainer;
 
+/** \brief Whether records of type T are indexed by the name returned from `T::getIndexedName()`.
+ */
+template<typename T, typename = void>
+inline constexpr bool isNameIndexed = false;
+
+template<typename T>
+inline constexpr bool isNameIndexed<T, std::void_t<decltype(std::declval<const T&>().getIndexedName())>> = true;
+
 /** \brief Template of PendingInterest, RegisteredPrefix, and InterestFilterRecord.
  *  \tparam T concrete type
  */
@@ -68,6 +75,10 @@ private:
 
 /** \brief Container of PendingInterest, RegisteredPrefix, or InterestFilterRecord.
  *  \tparam T record type
+ *
+ *  If T provides a `const Name& getIndexedName() const` method, the container additionally
+ *  maintains a NameIndex over the records, so that removeIfPrefixOf() and removeIfNameEquals()
+ *  only visit records that can match the given name.
  */
 template<typename T>
 class RecordContainer
@@ -102,6 +113,9 @@ public:
     Record& record = it->second;
     record.m_container = this;
     record.m_id = id;
+    if constexpr (isNameIndexed<T>) {
+      m_index.insert(record.getIndexedName(), id);
+    }
     return record;
   }
 
@@ -124,7 +138,9 @@ public:
   void
   erase(RecordId id)
   {
-    m_container.erase(id);
+    if (auto it = m_container.find(id); it != m_container.end()) {
+      eraseRecord(it);
+    }
     if (empty()) {
       this->onEmpty();
     }
@@ -133,6 +149,9 @@ public:
   void
   clear()
   {
+    if constexpr (isNameIndexed<T>) {
+      m_index.clear();
+    }
     m_container.clear();
     this->onEmpty();
   }
@@ -148,7 +167,7 @@ public:
     for (auto i = m_container.begin(); i != m_container.end(); ) {
       bool wantErase = f(i->second);
       if (wantErase) {
-        i = m_container.erase(i);
+        i = eraseRecord(i);
       }
       else {
         ++i;
@@ -173,6 +192,59 @@ public:
     });
   }
 
+  /** \brief Visit records whose indexed name is a prefix of \p name, with the option to erase.
+   *  \tparam Visitor function of type 'bool f(Record& record)'
+   *  \param name the name to look up
+   *  \param includeImplicitDigest also visit records whose indexed name is \p name followed by
+   *                               an implicit digest component
+   *  \param f visitor function, return true to erase record
+   *
+   *  Records are visited in the same order as removeIf().
+   */
+  template<typename Visitor>
+  void
+  removeIfPrefixOf(const Name& name, bool includeImplicitDigest, const Visitor& f)
+  {
+    static_assert(isNameIndexed<T>);
+    std::vector<RecordId> ids;
+    m_index.findPrefixesOf(name, includeImplicitDigest, ids);
+    removeIfAmong(ids, f);
+  }
+
+  /** \brief Visit records whose indexed name is a prefix of \p name.
+   *  \tparam Visitor function of type 'void f(Record& record)'
+   *  \param name the name to look up
+   *  \param f visitor function
+   *
+   *  Records are visited in the same order as forEach().
+   */
+  template<typename Visitor>
+  void
+  forEachPrefixOf(const Name& name, const Visitor& f)
+  {
+    removeIfPrefixOf(name, false, [&f] (Record& record) {
+      f(record);
+      return false;
+    });
+  }
+
+  /** \brief Visit records whose indexed name equals \p name, with the option to erase.
+   *  \tparam Visitor function of type 'bool f(Record& record)'
+   *  \param name the name to look up
+   *  \param f visitor function, return true to erase record
+   *
+   *  Records are visited in the same order as removeIf().
+   */
+  template<typename Visitor>
+  void
+  removeIfNameEquals(const Name& name, const Visitor& f)
+  {
+    static_assert(isNameIndexed<T>);
+    std::vector<RecordId> ids;
+    m_index.findExact(name, ids);
+    removeIfAmong(ids, f);
+  }
+
   [[nodiscard]] bool
   empty() const noexcept
   {
@@ -190,8 +262,37 @@ public:
    */
   signal::Signal<RecordContainer<T>> onEmpty;
 
+private:
+  typename Container::iterator
+  eraseRecord(typename Container::iterator it)
+  {
+    if constexpr (isNameIndexed<T>) {
+      m_index.erase(it->second.getIndexedName(), it->first);
+    }
+    return m_container.erase(it);
+  }
+
+  template<typename Visitor>
+  void
+  removeIfAmong(std::vector<RecordId>& ids, const Visitor& f)
+  {
+    // visit in ascending ID order, which is the iteration order of m_container
+    std::sort(ids.begin(), ids.end());
+    for (auto id : ids) {
+      // a previous visit may have erased this record
+      auto it = m_container.find(id);
+      if (it != m_container.end() && f(it->second)) {
+        eraseRecord(it);
+      }
+    }
+    if (empty()) {
+      this->onEmpty();
+    }
+  }
+
 private:
   Container m_container;
+  NameIndex m_index;
   std::atomic<RecordId> m_lastId{0};
 };
 
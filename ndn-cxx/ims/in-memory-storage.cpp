@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -118,8 +118,8 @@ void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
   // check if identical Data/Name already exists
-  auto it = m_cache.get<byFullName>().find(data.getFullName());
-  if (it != m_cache.get<byFullName>().end())
+  auto it = m_cache.get<byFullNameHash>().find(data.getFullName());
+  if (it != m_cache.get<byFullNameHash>().end())
     return;
 
   // if full, double the capacity
@@ -154,6 +154,13 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
+  // an exact match of the full name is the lower bound, thus the answer
+  auto hashIt = m_cache.get<byFullNameHash>().find(name);
+  if (hashIt != m_cache.get<byFullNameHash>().end()) {
+    afterAccess(*hashIt);
+    return ((*hashIt)->getData()).shared_from_this();
+  }
+
   auto it = m_cache.get<byFullName>().lower_bound(name);
 
   // if not found, return null
@@ -174,16 +181,26 @@ shared_ptr<const Data>
 InMemoryStorage::find(const Interest& interest)
 {
   // if the interest contains implicit digest, it is possible to directly locate a packet.
-  auto it = m_cache.get<byFullName>().find(interest.getName());
+  auto hashIt = m_cache.get<byFullNameHash>().find(interest.getName());
 
   // if a packet is located by its full name, it must be the packet to return.
-  if (it != m_cache.get<byFullName>().end()) {
-    return ((*it)->getData()).shared_from_this();
+  if (hashIt != m_cache.get<byFullNameHash>().end()) {
+    return ((*hashIt)->getData()).shared_from_this();
+  }
+
+  // without CanBePrefix, only the packets with the same name can match
+  if (!interest.getCanBePrefix()) {
+    InMemoryStorageEntry* ret = selectExact(interest);
+    if (ret == nullptr) {
+      return nullptr;
+    }
+    afterAccess(ret);
+    return ret->getData().shared_from_this();
   }
 
   // if the packet is not discovered by last step, either the packet is not in the storage or
   // the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
+  auto it = m_cache.get<byFullName>().lower_bound(interest.getName());
 
   if (it == m_cache.get<byFullName>().end()) {
     return nullptr;
@@ -215,6 +232,25 @@ InMemoryStorage::findNextFresh(Cache::index<byFullName>::type::iterator it) cons
   return it;
 }
 
+InMemoryStorageEntry*
+InMemoryStorage::selectExact(const Interest& interest) const
+{
+  InMemoryStorageEntry* best = nullptr;
+  auto range = m_cache.get<byNameHash>().equal_range(interest.getName());
+  for (auto it = range.first; it != range.second; ++it) {
+    InMemoryStorageEntry* entry = *it;
+    if (interest.getMustBeFresh() && !entry->isFresh()) {
+      continue;
+    }
+    // prefer the leftmost match, as selectChild() does
+    if ((best == nullptr || entry->getFullName() < best->getFullName()) &&
+        interest.matchesData(entry->getData())) {
+      best = entry;
+    }
+  }
+  return best;
+}
+
 InMemoryStorageEntry*
 InMemoryStorage::selectChild(const Interest& interest,
                              Cache::index<byFullName>::type::iterator startingPoint) const
@@ -286,13 +322,13 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
     }
   }
   else {
-    auto it = m_cache.get<byFullName>().find(prefix);
-    if (it == m_cache.get<byFullName>().end())
+    auto it = m_cache.get<byFullNameHash>().find(prefix);
+    if (it == m_cache.get<byFullNameHash>().end())
       return;
 
     // let derived class do something with the entry
     beforeErase(*it);
-    freeEntry(it);
+    freeEntry(m_cache.project<byFullName>(it));
   }
 
   if (m_freeEntries.size() > (2 * size()))
@@ -302,11 +338,11 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
 void
 InMemoryStorage::eraseImpl(const Name& name)
 {
-  auto it = m_cache.get<byFullName>().find(name);
-  if (it == m_cache.get<byFullName>().end())
+  auto it = m_cache.get<byFullNameHash>().find(name);
+  if (it == m_cache.get<byFullNameHash>().end())
     return;
 
-  freeEntry(it);
+  freeEntry(m_cache.project<byFullName>(it));
 }
 
 InMemoryStorage::const_iterator
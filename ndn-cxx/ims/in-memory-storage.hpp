@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -28,6 +28,7 @@
 #include <stack>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
@@ -43,6 +44,8 @@ class InMemoryStorage : noncopyable
 public:
   // multi_index_container to implement storage
   class byFullName;
+  class byFullNameHash;
+  class byNameHash;
 
   using Cache = boost::multi_index_container<
     InMemoryStorageEntry*,
@@ -53,6 +56,20 @@ public:
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
                                           &InMemoryStorageEntry::getFullName>,
         std::less<Name>
+      >,
+      // by Full Name, for exact match in constant time
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byFullNameHash>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getFullName>,
+        std::hash<Name>
+      >,
+      // by Name without implicit digest, for exact match in constant time
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byNameHash>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
       >
     >
   >;
@@ -148,6 +165,10 @@ public:
   insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow = INFINITE_WINDOW);
 
   /** @brief Finds the best match Data for an Interest.
+   *
+   *  An Interest whose name is the full name of a stored Data packet, or an Interest without
+   *  CanBePrefix, is answered in constant time through hashed indexes. Otherwise, the stored
+   *  packets under the Interest name are searched in canonical order.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *  As currently it is impossible to determine whether a Name contains implicit digest or not,
@@ -320,6 +341,13 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Cache::index<byFullName>::type::iterator
   findNextFresh(Cache::index<byFullName>::type::iterator startingPoint) const;
 
+  /** @brief Find the best match for an Interest without CanBePrefix among the entries whose
+   *         name equals the Interest name.
+   *  @return the match with the smallest full name, if any; otherwise nullptr
+   */
+  InMemoryStorageEntry*
+  selectExact(const Interest& interest) const;
+
 private:
   void
   init();
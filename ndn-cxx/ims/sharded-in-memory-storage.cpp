@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/sharded-in-memory-storage.hpp"
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+
+namespace ndn {
+
+ShardedInMemoryStorage::ShardedInMemoryStorage(size_t nShards, size_t prefixLength,
+                                               const ShardFactory& makeShard)
+  : m_prefixLength(prefixLength)
+{
+  if (nShards == 0) {
+    NDN_THROW(std::invalid_argument("nShards must be positive"));
+  }
+
+  m_shards.reserve(nShards);
+  for (size_t i = 0; i < nShards; ++i) {
+    auto& shard = m_shards.emplace_back(make_unique<Shard>());
+    shard->storage = makeShard ? makeShard() : make_unique<InMemoryStoragePersistent>();
+    if (shard->storage == nullptr) {
+      NDN_THROW(std::invalid_argument("ShardFactory returned nullptr"));
+    }
+  }
+}
+
+ShardedInMemoryStorage::~ShardedInMemoryStorage() = default;
+
+std::optional<size_t>
+ShardedInMemoryStorage::getShardIndex(const Name& name) const
+{
+  if (name.size() < m_prefixLength) {
+    return std::nullopt;
+  }
+  return name.getPrefixHash(m_prefixLength) % m_shards.size();
+}
+
+template<typename F>
+void
+ShardedInMemoryStorage::forEachShard(const Name& name, const F& f)
+{
+  if (auto index = getShardIndex(name); index) {
+    Shard& shard = *m_shards[*index];
+    std::lock_guard lock(shard.mutex);
+    f(*shard.storage);
+    return;
+  }
+
+  for (auto& shard : m_shards) {
+    std::lock_guard lock(shard->mutex);
+    f(*shard->storage);
+  }
+}
+
+void
+ShardedInMemoryStorage::insert(const Data& data)
+{
+  const Name& fullName = data.getFullName();
+  // a decoded packet parses its wire encoding on first use, which must not happen concurrently
+  data.wireEncode();
+  // a full name shorter than prefixLength is assigned by the hash of the whole name,
+  // which is where an erasure of that exact full name will look for it
+  Shard& shard = *m_shards[fullName.getPrefixHash(m_prefixLength) % m_shards.size()];
+  std::lock_guard lock(shard.mutex);
+  shard.storage->insert(data);
+}
+
+shared_ptr<const Data>
+ShardedInMemoryStorage::find(const Interest& interest)
+{
+  shared_ptr<const Data> best;
+  forEachShard(interest.getName(), [&] (InMemoryStorage& storage) {
+    auto data = storage.find(interest);
+    if (data != nullptr && (best == nullptr || data->getFullName() < best->getFullName())) {
+      best = std::move(data);
+    }
+  });
+  return best;
+}
+
+shared_ptr<const Data>
+ShardedInMemoryStorage::find(const Name& name)
+{
+  shared_ptr<const Data> best;
+  forEachShard(name, [&] (InMemoryStorage& storage) {
+    auto data = storage.find(name);
+    if (data != nullptr && (best == nullptr || data->getFullName() < best->getFullName())) {
+      best = std::move(data);
+    }
+  });
+  return best;
+}
+
+void
+ShardedInMemoryStorage::erase(const Name& prefix, bool isPrefix)
+{
+  if (!isPrefix) {
+    Shard& shard = *m_shards[prefix.getPrefixHash(m_prefixLength) % m_shards.size()];
+    std::lock_guard lock(shard.mutex);
+    shard.storage->erase(prefix, false);
+    return;
+  }
+
+  forEachShard(prefix, [&] (InMemoryStorage& storage) {
+    storage.erase(prefix, true);
+  });
+}
+
+size_t
+ShardedInMemoryStorage::size() const
+{
+  size_t total = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard lock(shard->mutex);
+    total += shard->storage->size();
+  }
+  return total;
+}
+
+} // namespace ndn
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMS_SHARDED_IN_MEMORY_STORAGE_HPP
+#define NDN_CXX_IMS_SHARDED_IN_MEMORY_STORAGE_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <mutex>
+
+namespace ndn {
+
+/**
+ * @brief In-memory storage that can be shared by multiple threads.
+ *
+ * The packets are partitioned among a number of shards, each of which is an InMemoryStorage
+ * protected by its own lock, so that threads operating on different shards do not contend.
+ * A Data packet is assigned to a shard by the hash of the first @c prefixLength components of
+ * its full name, which is computed with Name::getPrefixHash().
+ *
+ * Lookups and erasures by a name that has at least @c prefixLength components are directed to
+ * a single shard, because every packet under that name is in the same shard. Shorter names can
+ * match packets in any shard, hence all shards are searched and the leftmost match in canonical
+ * order is returned, as InMemoryStorage::find() does. Therefore, @c prefixLength should be set
+ * to the number of components of the shortest names that are commonly looked up, e.g., the
+ * application prefix followed by the object name.
+ *
+ * @par Thread safety
+ * insert(), find(), erase(), and size() may be called concurrently from multiple threads on the
+ * same ShardedInMemoryStorage. The shard of a name is selected with Name::getPrefixHash(), which
+ * may be called concurrently on a shared name because the hash values are published atomically
+ * when they are first computed, before any lock is taken; each shard is then accessed under its
+ * own lock.
+ * The following guarantees apply to the arguments and the returned packets:
+ *  - The Name and Interest arguments are only read, so they may be shared with other threads
+ *    that are also only reading them.
+ *  - insert() calls Data::getFullName() and Data::wireEncode() on its argument, which compute
+ *    and cache the full name and the parsed wire encoding on first use. Hence, a Data that other
+ *    threads access at the same time must already have both of them computed.
+ *  - The storage keeps the inserted Data object itself (through `shared_from_this()`) rather than
+ *    a copy, and never modifies it; the caller must not modify it after insertion either. The
+ *    returned packets remain valid after they are erased or evicted, and their const member
+ *    functions may be called concurrently, provided that each inserted packet was fully decoded,
+ *    i.e., Data::decodeRemaining() was called if it was decoded with Data::wireDecodeLazy().
+ *
+ * @note The shards must not be created with an io_context, because the Scheduler that marks
+ *       stale entries is not thread-safe; consequently, MustBeFresh is not considered.
+ */
+class ShardedInMemoryStorage : noncopyable
+{
+public:
+  /**
+   * @brief Function that creates the storage of one shard.
+   */
+  using ShardFactory = std::function<unique_ptr<InMemoryStorage>()>;
+
+  /**
+   * @brief Create a ShardedInMemoryStorage.
+   * @param nShards number of shards, must be positive
+   * @param prefixLength number of leading components of the full name that select the shard
+   * @param makeShard function that creates the storage of each shard, which determines the
+   *                  replacement policy and the limit of each shard; by default, each shard
+   *                  is an unlimited InMemoryStoragePersistent
+   */
+  ShardedInMemoryStorage(size_t nShards, size_t prefixLength, const ShardFactory& makeShard = nullptr);
+
+  ~ShardedInMemoryStorage();
+
+  size_t
+  getNShards() const noexcept
+  {
+    return m_shards.size();
+  }
+
+  /**
+   * @brief Inserts a Data packet.
+   * @param data the packet to insert, must be signed and have wire encoding
+   * @sa InMemoryStorage::insert()
+   */
+  void
+  insert(const Data& data);
+
+  /**
+   * @brief Finds the best match Data for an Interest.
+   * @sa InMemoryStorage::find(const Interest&)
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /**
+   * @brief Finds the best match Data for a Name with or without implicit digest.
+   * @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /**
+   * @brief Deletes the entries under @p prefix, or the entry with full name @p prefix
+   *        if @p isPrefix is false.
+   * @sa InMemoryStorage::erase()
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /**
+   * @brief Returns the number of packets stored in all shards.
+   */
+  size_t
+  size() const;
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * @brief Returns the index of the shard that contains all packets under @p name.
+   * @retval std::nullopt @p name is too short, packets under it can be in any shard
+   */
+  std::optional<size_t>
+  getShardIndex(const Name& name) const;
+
+private:
+  struct Shard
+  {
+    mutable std::mutex mutex;
+    unique_ptr<InMemoryStorage> storage;
+  };
+
+  /**
+   * @brief Apply @p f to the storage of the shard(s) that may contain packets under @p name.
+   */
+  template<typename F>
+  void
+  forEachShard(const Name& name, const F& f);
+
+private:
+  std::vector<unique_ptr<Shard>> m_shards;
+  const size_t m_prefixLength;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_IMS_SHARDED_IN_MEMORY_STORAGE_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -21,7 +21,9 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/impl/peek-name.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
@@ -97,7 +99,11 @@ Interest::wireEncode(EncodingImpl<TAG>& encoder) const
   totalLength += prependBinaryBlock(encoder, tlv::Nonce, *m_nonce);
 
   // ForwardingHint
-  if (!m_forwardingHint.empty()) {
+  if (m_lazyForwardingHint.isValid()) {
+    // deferred by wireDecodeLazy(), copied verbatim
+    totalLength += prependBlock(encoder, m_lazyForwardingHint);
+  }
+  else if (!m_forwardingHint.empty()) {
     totalLength += prependNestedBlock(encoder, tlv::ForwardingHint,
                                       m_forwardingHint.begin(), m_forwardingHint.end());
   }
@@ -125,27 +131,101 @@ NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Interest);
 const Block&
 Interest::wireEncode() const
 {
-  if (m_wire.hasWire())
+  if (m_wire.hasWire()) {
+    // decoding walks m_wire without parsing it, the sub-elements are created on first request
+    m_wire.parse();
     return m_wire;
+  }
 
   EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
 
+  // the packet retains its encoding, so it is not encoded into a pooled buffer (see Data)
   EncodingBuffer encoder(estimatedSize, 0);
   wireEncode(encoder);
 
   const_cast<Interest*>(this)->wireDecode(encoder.block());
+  m_wire.parse();
   return m_wire;
 }
 
 void
 Interest::wireDecode(const Block& wire)
+{
+  decodeWire(wire, false);
+}
+
+void
+Interest::wireDecodeLazy(const Block& wire)
+{
+  decodeWire(wire, true);
+}
+
+span<const uint8_t>
+Interest::peekName(span<const uint8_t> wire)
+{
+  return detail::peekName(wire, tlv::Interest, "Interest");
+}
+
+static std::vector<Name>
+decodeForwardingHint(const Block& element)
+{
+  // Current format:
+  //   ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Name
+  // Previous format, partially supported for backward compatibility:
+  //   ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Delegation
+  //   Delegation = DELEGATION-TYPE TLV-LENGTH Preference Name
+  std::vector<Name> forwardingHint;
+  element.parse();
+  for (const auto& del : element.elements()) {
+    switch (del.type()) {
+      case tlv::Name:
+        try {
+          forwardingHint.emplace_back(del);
+        }
+        catch (const tlv::Error&) {
+          NDN_THROW_NESTED(Interest::Error("Invalid Name in ForwardingHint"));
+        }
+        break;
+      case 31: // Delegation
+        // old ForwardingHint format, try to parse the nested Name for compatibility
+        try {
+          del.parse();
+          forwardingHint.emplace_back(del.get(tlv::Name));
+        }
+        catch (const tlv::Error&) {
+          NDN_THROW_NESTED(Interest::Error("Invalid Name in ForwardingHint.Delegation"));
+        }
+        break;
+      default:
+        if (tlv::isCriticalType(del.type())) {
+          NDN_THROW(Interest::Error("Unexpected TLV-TYPE " + to_string(del.type()) +
+                                    " while decoding ForwardingHint"));
+        }
+        break;
+    }
+  }
+  return forwardingHint;
+}
+
+void
+Interest::decodeRemaining()
+{
+  if (m_lazyForwardingHint.isValid()) {
+    m_forwardingHint = decodeForwardingHint(m_lazyForwardingHint);
+    m_lazyForwardingHint = {};
+  }
+}
+
+void
+Interest::decodeWire(const Block& wire, bool isLazy)
 {
   if (wire.type() != tlv::Interest) {
     NDN_THROW(Error("Interest", wire.type()));
   }
-  m_wire = wire;
-  m_wire.parse();
+  // share the buffer of wire, but not its sub-elements (if parsed), which are not needed
+  m_wire = wire.hasWire() ? Block(wire, wire.begin(), wire.end()) : wire;
+  m_wire.encode();
 
   // Interest = INTEREST-TYPE TLV-LENGTH
   //              Name
@@ -157,13 +237,15 @@ Interest::wireDecode(const Block& wire)
   //              [HopLimit]
   //              [ApplicationParameters [InterestSignature]]
 
-  auto element = m_wire.elements_begin();
-  if (element == m_wire.elements_end() || element->type() != tlv::Name) {
+  // iterate over a BlockView, so that only the retained elements are turned into Blocks
+  const auto elements = BlockView(m_wire).elements();
+  auto element = elements.begin();
+  if (element == elements.end() || element->type() != tlv::Name) {
     NDN_THROW(Error("Name element is missing or out of order"));
   }
   // decode into a temporary object until we determine that the name is valid, in order
   // to maintain class invariants and thus provide a basic form of exception safety
-  Name tempName(*element);
+  Name tempName(element->toBlock(m_wire));
   if (tempName.empty()) {
     NDN_THROW(Error("Name has zero name components"));
   }
@@ -175,13 +257,14 @@ Interest::wireDecode(const Block& wire)
 
   m_canBePrefix = m_mustBeFresh = false;
   m_forwardingHint.clear();
+  m_lazyForwardingHint = {};
   m_nonce.reset();
   m_interestLifetime = DEFAULT_INTEREST_LIFETIME.count();
   m_hopLimit.reset();
   m_parameters.clear();
 
   int lastElement = 1; // last recognized element index, in spec order
-  for (++element; element != m_wire.elements_end(); ++element) {
+  for (++element; element != elements.end(); ++element) {
     switch (element->type()) {
       case tlv::CanBePrefix: {
         if (lastElement >= 2) {
@@ -209,38 +292,11 @@ Interest::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("ForwardingHint element is out of order"));
         }
-        // Current format:
-        //   ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Name
-        // Previous format, partially supported for backward compatibility:
-        //   ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Delegation
-        //   Delegation = DELEGATION-TYPE TLV-LENGTH Preference Name
-        element->parse();
-        for (const auto& del : element->elements()) {
-          switch (del.type()) {
-            case tlv::Name:
-              try {
-                m_forwardingHint.emplace_back(del);
-              }
-              catch (const tlv::Error&) {
-                NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint"));
-              }
-              break;
-            case 31: // Delegation
-              // old ForwardingHint format, try to parse the nested Name for compatibility
-              try {
-                del.parse();
-                m_forwardingHint.emplace_back(del.get(tlv::Name));
-              }
-              catch (const tlv::Error&) {
-                NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint.Delegation"));
-              }
-              break;
-            default:
-              if (tlv::isCriticalType(del.type())) {
-                NDN_THROW(Error("Unexpected TLV-TYPE " + to_string(del.type()) + " while decoding ForwardingHint"));
-              }
-              break;
-          }
+        if (isLazy) {
+          m_lazyForwardingHint = element->toBlock(m_wire);
+        }
+        else {
+          m_forwardingHint = decodeForwardingHint(element->toBlock(m_wire));
         }
         lastElement = 4;
         break;
@@ -253,7 +309,7 @@ Interest::wireDecode(const Block& wire)
           NDN_THROW(Error("Nonce element is malformed"));
         }
         m_nonce.emplace();
-        std::memcpy(m_nonce->data(), element->value(), m_nonce->size());
+        std::memcpy(m_nonce->data(), element->value().data(), m_nonce->size());
         lastElement = 5;
         break;
       }
@@ -261,7 +317,7 @@ Interest::wireDecode(const Block& wire)
         if (lastElement >= 6) {
           NDN_THROW(Error("InterestLifetime element is out of order"));
         }
-        m_interestLifetime = readNonNegativeInteger(*element);
+        m_interestLifetime = readNonNegativeInteger(element->toBlock(m_wire));
         lastElement = 6;
         break;
       }
@@ -272,7 +328,7 @@ Interest::wireDecode(const Block& wire)
         if (element->value_size() != 1) {
           NDN_THROW(Error("HopLimit element is malformed"));
         }
-        m_hopLimit = *element->value();
+        m_hopLimit = element->value()[0];
         lastElement = 7;
         break;
       }
@@ -281,7 +337,7 @@ Interest::wireDecode(const Block& wire)
           break; // ApplicationParameters is non-critical, ignore out-of-order appearance
         }
         BOOST_ASSERT(!hasApplicationParameters());
-        m_parameters.push_back(*element);
+        m_parameters.push_back(element->toBlock(m_wire));
         lastElement = 8;
         break;
       }
@@ -292,7 +348,7 @@ Interest::wireDecode(const Block& wire)
         }
         // if we already encountered ApplicationParameters, store this element as parameter
         if (hasApplicationParameters()) {
-          m_parameters.push_back(*element);
+          m_parameters.push_back(element->toBlock(m_wire));
         }
         // otherwise, ignore it
         break;
@@ -300,7 +356,7 @@ Interest::wireDecode(const Block& wire)
     }
   }
 
-  if (s_autoCheckParametersDigest && !isParametersDigestValid()) {
+  if (!isLazy && s_autoCheckParametersDigest && !isParametersDigestValid()) {
     NDN_THROW(Error("ParametersSha256DigestComponent does not match the SHA-256 of Interest parameters"));
   }
 }
@@ -392,6 +448,7 @@ Interest&
 Interest::setForwardingHint(std::vector<Name> value)
 {
   m_forwardingHint = std::move(value);
+  m_lazyForwardingHint = {};
   m_wire.reset();
   return *this;
 }
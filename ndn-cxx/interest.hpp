@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -122,6 +122,7 @@ public:
 
   /**
    * @brief Encode into a Block.
+   * @note The encoding of a decoded packet is parsed into sub-elements on the first call.
    */
   const Block&
   wireEncode() const;
@@ -132,6 +133,42 @@ public:
   void
   wireDecode(const Block& wire);
 
+  /**
+   * @brief Decode from @p wire, deferring the decoding of `ForwardingHint`.
+   *
+   * The top-level structure of the packet, the Name, and all other elements are decoded and
+   * validated immediately, while `ForwardingHint` is retained undecoded until decodeRemaining()
+   * is called. Re-encoding the packet copies the undecoded element verbatim. In addition, the
+   * ParametersSha256DigestComponent is not checked against the Interest parameters, regardless
+   * of getAutoCheckParametersDigest(); use isParametersDigestValid() if necessary.
+   *
+   * @throw Error the top-level structure or any eagerly decoded element is invalid
+   * @note getForwardingHint() throws Error until decodeRemaining() is called.
+   */
+  void
+  wireDecodeLazy(const Block& wire);
+
+  /**
+   * @brief Decode the `ForwardingHint` that was deferred by wireDecodeLazy().
+   *
+   * This is a no-op if the packet was decoded with wireDecode() or has already been fully decoded.
+   *
+   * @throw Error `ForwardingHint` is invalid
+   */
+  void
+  decodeRemaining();
+
+  /**
+   * @brief Locate the Name of the Interest packet in @p wire without decoding the packet.
+   * @return the complete Name element, within @p wire
+   * @throw tlv::Error @p wire does not start with an Interest packet, or the packet does not
+   *                   start with a Name element
+   *
+   * Neither the Name nor the remainder of the packet are validated.
+   */
+  static span<const uint8_t>
+  peekName(span<const uint8_t> wire);
+
   /**
    * @brief Check if this instance has cached wire encoding.
    */
@@ -222,10 +259,14 @@ public: // Interest fields
 
   /**
    * @brief Get the delegations (names) in the `ForwardingHint`.
+   * @throw Error The packet was decoded with wireDecodeLazy() and decodeRemaining() was not called.
    */
   span<const Name>
-  getForwardingHint() const noexcept
+  getForwardingHint() const
   {
+    if (m_lazyForwardingHint.isValid()) {
+      NDN_THROW(Error("ForwardingHint has not been decoded, decodeRemaining() must be called first"));
+    }
     return m_forwardingHint;
   }
 
@@ -513,6 +554,9 @@ private:
   std::vector<Block>::const_iterator
   findFirstParameter(uint32_t type) const;
 
+  void
+  decodeWire(const Block& wire, bool isLazy);
+
 private:
   Name m_name;
   std::vector<Name> m_forwardingHint;
@@ -531,6 +575,8 @@ private:
   std::vector<Block> m_parameters;
 
   mutable Block m_wire;
+  // ForwardingHint not yet decoded after wireDecodeLazy(), invalid if already decoded
+  Block m_lazyForwardingHint;
 
   static inline bool s_autoCheckParametersDigest = true;
 };
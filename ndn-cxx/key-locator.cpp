@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -48,6 +48,10 @@ KeyLocator::wireEncode(EncodingImpl<TAG>& encoder) const
   // KeyLocator = KEY-LOCATOR-TYPE TLV-LENGTH (Name / KeyDigest)
   // KeyDigest = KEY-DIGEST-TYPE TLV-LENGTH *OCTET
 
+  if (m_wire.hasWire()) {
+    return prependBlock(encoder, m_wire);
+  }
+
   size_t totalLength = 0;
 
   std::visit(boost::hana::overload(
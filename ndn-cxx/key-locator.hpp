@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -56,6 +56,8 @@ public: // constructors
 
 public: // encode and decode
   /** \brief Prepend wire encoding to \p encoder.
+   *
+   *  If this instance has a cached wire encoding, it is prepended as is.
    */
   template<encoding::Tag TAG>
   size_t
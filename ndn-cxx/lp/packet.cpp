@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/lp/packet.hpp"
 #include "ndn-cxx/lp/fields.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 
 #include <boost/mp11/algorithm.hpp>
 
@@ -91,10 +92,12 @@ Block
 Packet::wireEncode() const
 {
   // If no header or trailer, return bare network packet
-  auto elements = m_wire.elements();
-  if (elements.size() == 1 && elements.front().type() == FragmentField::TlvType::value) {
-    elements.front().parse();
-    return elements.front().elements().front();
+  if (countFields(0) == 1) {
+    Block fragment = getField(FragmentField::TlvType::value, 0);
+    if (fragment.isValid()) {
+      fragment.parse();
+      return fragment.elements().front();
+    }
   }
 
   m_wire.encode();
@@ -114,11 +117,14 @@ Packet::wireDecode(const Block& wire)
     NDN_THROW(Error("LpPacket", wire.type()));
   }
 
-  wire.parse();
+  Block decoded = wire;
+  decoded.encode();
 
+  // validate the fields with a BlockView, so that a malformed packet is rejected
+  // before any sub-element Block is created
   bool isFirst = true;
   FieldInfo prev;
-  for (const Block& element : wire.elements()) {
+  for (const auto& element : BlockView(decoded).elements()) {
     FieldInfo info(element.type());
 
     if (!info.isRecognized && !info.canIgnore) {
@@ -139,7 +145,44 @@ Packet::wireDecode(const Block& wire)
     prev = info;
   }
 
-  m_wire = wire;
+  // the fields are read from the encoding until the packet is modified
+  m_wire = std::move(decoded);
+}
+
+size_t
+Packet::countFields(uint32_t type) const
+{
+  if (isParsed()) {
+    return std::count_if(m_wire.elements_begin(), m_wire.elements_end(),
+                         [type] (const Block& element) { return type == 0 || element.type() == type; });
+  }
+
+  size_t count = 0;
+  for (const auto& element : BlockView(m_wire).elements()) {
+    count += type == 0 || element.type() == type ? 1 : 0;
+  }
+  return count;
+}
+
+Block
+Packet::getField(uint32_t type, size_t index) const
+{
+  size_t count = 0;
+  if (isParsed()) {
+    for (const Block& element : m_wire.elements()) {
+      if (element.type() == type && count++ == index) {
+        return element;
+      }
+    }
+  }
+  else {
+    for (const auto& element : BlockView(m_wire).elements()) {
+      if (element.type() == type && count++ == index) {
+        return element.toBlock(m_wire);
+      }
+    }
+  }
+  return {};
 }
 
 bool
@@ -65,7 +65,7 @@ public:
   [[nodiscard]] bool
   empty() const
   {
-    return m_wire.elements_size() == 0;
+    return isParsed() ? m_wire.elements_size() == 0 : m_wire.value_size() == 0;
   }
 
 public: // field access
@@ -87,8 +87,7 @@ public: // field access
   [[nodiscard]] size_t
   count() const
   {
-    return std::count_if(m_wire.elements_begin(), m_wire.elements_end(),
-                         [] (const Block& block) { return block.type() == FIELD::TlvType::value; });
+    return countFields(FIELD::TlvType::value);
   }
 
   /**
@@ -99,17 +98,11 @@ public: // field access
   typename FIELD::ValueType
   get(size_t index = 0) const
   {
-    size_t count = 0;
-    for (const Block& element : m_wire.elements()) {
-      if (element.type() != FIELD::TlvType::value) {
-        continue;
-      }
-      if (count++ == index) {
-        return FIELD::decode(element);
-      }
+    Block element = getField(FIELD::TlvType::value, index);
+    if (!element.isValid()) {
+      NDN_THROW(std::out_of_range("lp::Packet::get: index out of range"));
     }
-
-    NDN_THROW(std::out_of_range("lp::Packet::get: index out of range"));
+    return FIELD::decode(element);
   }
 
   /**
@@ -121,9 +114,10 @@ public: // field access
   {
     std::vector<typename FIELD::ValueType> output;
 
-    for (const Block& element : m_wire.elements()) {
-      if (element.type() != FIELD::TlvType::value) {
-        continue;
+    for (size_t i = 0;; ++i) {
+      Block element = getField(FIELD::TlvType::value, i);
+      if (!element.isValid()) {
+        break;
       }
       output.push_back(FIELD::decode(element));
     }
@@ -161,6 +155,7 @@ public: // field access
     FIELD::encode(buffer, value);
     Block block = buffer.block();
 
+    m_wire.parse();
     auto pos = std::upper_bound(m_wire.elements_begin(), m_wire.elements_end(),
                                 FIELD::TlvType::value, comparePos);
     m_wire.insert(pos, block);
@@ -176,6 +171,7 @@ public: // field access
   Packet&
   remove(size_t index = 0)
   {
+    m_wire.parse();
     size_t count = 0;
     for (auto it = m_wire.elements_begin(); it != m_wire.elements_end(); ++it) {
       if (it->type() == FIELD::TlvType::value) {
@@ -197,11 +193,36 @@ public: // field access
   Packet&
   clear()
   {
+    m_wire.parse();
     m_wire.remove(FIELD::TlvType::value);
     return *this;
   }
 
 private:
+  /**
+   * \brief Returns whether the fields are stored as sub-elements of m_wire.
+   *
+   * A decoded packet is parsed when it is first modified. Until then, the fields are read
+   * directly from the wire encoding, and a Block is created only for the fields that are decoded.
+   */
+  bool
+  isParsed() const noexcept
+  {
+    return !m_wire.hasWire() || m_wire.elements_size() > 0;
+  }
+
+  /**
+   * \brief Returns the number of fields of TLV-TYPE \p type, or of all fields if \p type is 0.
+   */
+  size_t
+  countFields(uint32_t type) const;
+
+  /**
+   * \brief Returns the index-th field of TLV-TYPE \p type, or an invalid Block if there is none.
+   */
+  Block
+  getField(uint32_t type, size_t index) const;
+
   static bool
   comparePos(uint32_t first, const Block& second) noexcept;
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -131,6 +131,10 @@ MetaInfo::wireEncode(EncodingImpl<TAG>& encoder) const
   //                FinalBlockId?
   //                AppMetaInfo*
 
+  if (m_wire.hasWire()) {
+    return prependBlock(encoder, m_wire);
+  }
+
   size_t totalLength = 0;
 
   // AppMetaInfo (in reverse order)
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -75,6 +75,11 @@ public:
   explicit
   MetaInfo(const Block& block);
 
+  /**
+   * @brief Prepend wire encoding to @p encoder.
+   *
+   * If this instance has a cached wire encoding, it is prepended as is.
+   */
   template<encoding::Tag TAG>
   size_t
   wireEncode(EncodingImpl<TAG>& encoder) const;
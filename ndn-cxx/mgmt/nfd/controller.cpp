@@ -32,6 +32,7 @@ Controller::Controller(Face& face, KeyChain& keyChain, security::Validator& vali
   , m_keyChain(keyChain)
   , m_validator(validator)
   , m_signer(keyChain)
+  , m_fetchManager(face, validator)
 {
 }
 
@@ -139,7 +140,7 @@ Controller::fetchDataset(const Name& prefix,
   SegmentFetcher::Options fetcherOptions;
   fetcherOptions.maxTimeout = options.getTimeout();
 
-  auto fetcher = SegmentFetcher::start(m_face, Interest(prefix), m_validator, fetcherOptions);
+  auto fetcher = m_fetchManager.start(Interest(prefix), options.getPrefix(), fetcherOptions);
   fetcher->onComplete.connect(processResponse);
   if (onFailure) {
     fetcher->onError.connect([onFailure] (uint32_t code, const std::string& msg) {
@@ -177,6 +178,10 @@ Controller::processDatasetFetchError(const DatasetFailureCallback& onFailure,
     case SegmentFetcher::ErrorCode::NACK_ERROR:
       onFailure(ERROR_NACK, msg);
       break;
+    case SegmentFetcher::ErrorCode::SINK_ERROR:
+      // Controller does not use 'sink' mode, so this cannot happen
+      onFailure(ERROR_SERVER, msg);
+      break;
   }
 }
 
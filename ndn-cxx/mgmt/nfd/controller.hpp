@@ -28,7 +28,7 @@
 #include "ndn-cxx/security/interest-signer.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/security/validator-null.hpp"
-#include "ndn-cxx/util/segment-fetcher.hpp"
+#include "ndn-cxx/util/segment-fetch-manager.hpp"
 
 namespace ndn {
 
@@ -186,6 +186,7 @@ protected:
   KeyChain& m_keyChain;
   security::Validator& m_validator;
   security::InterestSigner m_signer;
+  SegmentFetchManager m_fetchManager; ///< shares congestion control among datasets of the same forwarder
 
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   std::set<shared_ptr<SegmentFetcher>> m_fetchers;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -25,12 +25,13 @@
 
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <cstring>
 #include <sstream>
 #include <boost/functional/hash.hpp>
-#include <boost/range/adaptor/reversed.hpp>
 
 namespace ndn {
 
@@ -91,11 +92,7 @@ template<encoding::Tag TAG>
 size_t
 Name::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-  for (const Component& comp : *this | boost::adaptors::reversed) {
-    totalLength += comp.wireEncode(encoder);
-  }
-
+  size_t totalLength = encoder.prependBytes(m_value);
   totalLength += encoder.prependVarNumber(totalLength);
   totalLength += encoder.prependVarNumber(tlv::Name);
   return totalLength;
@@ -106,8 +103,8 @@ NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Name);
 const Block&
 Name::wireEncode() const
 {
-  if (m_wire.hasWire())
-    return m_wire;
+  if (auto wire = m_wire.get(); wire != nullptr)
+    return *wire;
 
   EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
@@ -115,10 +112,7 @@ Name::wireEncode() const
   EncodingBuffer buffer(estimatedSize, 0);
   wireEncode(buffer);
 
-  m_wire = buffer.block();
-  m_wire.parse();
-
-  return m_wire;
+  return m_wire.publish(make_shared<const Block>(buffer.block()));
 }
 
 void
@@ -127,22 +121,45 @@ Name::wireDecode(const Block& wire)
   if (wire.type() != tlv::Name)
     NDN_THROW(tlv::Error("Name", wire.type()));
 
-  m_wire = wire;
-  m_wire.parse();
+  Name decoded;
+  bool isCanonical = true;
+
+  auto input = wire.value_bytes();
+  decoded.m_value.reserve(input.size());
+  for (const auto& element : BlockView::Elements(input)) {
+    if (element.size() - element.value_size() ==
+        tlv::sizeOfVarNumber(element.type()) + tlv::sizeOfVarNumber(element.value_size())) {
+      decoded.m_offsets.push_back(static_cast<uint32_t>(decoded.m_value.size()));
+      decoded.m_value.insert(decoded.m_value.end(), element.wire().begin(), element.wire().end());
+    }
+    else {
+      // TLV-TYPE or TLV-LENGTH is not minimally encoded
+      isCanonical = false;
+      decoded.appendEncoded(element.type(), element.value());
+    }
+  }
+
+  m_value = std::move(decoded.m_value);
+  m_offsets = std::move(decoded.m_offsets);
+  resetCache();
+  // keep the original encoding, unless it differs from the canonical one
+  if (wire.hasWire() && isCanonical) {
+    m_wire.set(make_shared<const Block>(wire));
+  }
 }
 
 Name
 Name::deepCopy() const
 {
   Name copiedName(*this);
-  copiedName.m_wire.resetWire();
+  copiedName.resetCache();
   copiedName.wireEncode(); // "compress" the underlying buffer
   return copiedName;
 }
 
 // ---- accessors ----
 
-const name::Component&
+name::Component
 Name::at(ssize_t i) const
 {
   auto ssize = static_cast<ssize_t>(size());
@@ -153,7 +170,7 @@ Name::at(ssize_t i) const
   if (i < 0) {
     i += ssize;
   }
-  return static_cast<const Component&>(m_wire.elements()[static_cast<size_t>(i)]);
+  return makeComponent(static_cast<size_t>(i));
 }
 
 PartialName
@@ -169,12 +186,44 @@ Name::getSubName(ssize_t iStartComponent, size_t nComponents) const
   if (nComponents != npos)
     iEnd = std::min(size(), iStart + nComponents);
 
-  for (size_t i = iStart; i < iEnd; ++i)
-    result.append(at(i));
+  if (iStart >= iEnd)
+    return result;
 
+  size_t first = m_offsets[iStart];
+  size_t last = getEndOffset(iEnd - 1);
+  result.m_value.assign(m_value.begin() + first, m_value.begin() + last);
+  result.m_offsets.reserve(iEnd - iStart);
+  for (size_t i = iStart; i < iEnd; ++i)
+    result.m_offsets.push_back(static_cast<uint32_t>(m_offsets[i] - first));
   return result;
 }
 
+const Block::element_container&
+Name::makeComponents() const
+{
+  const Block& wire = wireEncode();
+  auto valueBegin = wire.value_begin();
+
+  auto components = make_shared<Block::element_container>();
+  components->reserve(size());
+  for (size_t i = 0; i < size(); ++i) {
+    components->emplace_back(wire.getBuffer(), valueBegin + m_offsets[i], valueBegin + getEndOffset(i));
+  }
+  return m_components.publish(std::move(components));
+}
+
+name::Component
+Name::makeComponent(size_t i) const
+{
+  if (auto components = m_components.get(); components != nullptr) {
+    return static_cast<const Component&>((*components)[i]);
+  }
+
+  const Block& wire = wireEncode();
+  auto valueBegin = wire.value_begin();
+  return Component(Block(wire.getBuffer(), valueBegin + m_offsets[i], valueBegin + getEndOffset(i)));
+}
+
 // ---- modifiers ----
 
 Name&
@@ -184,21 +233,77 @@ Name::set(ssize_t i, const Component& component)
     i += static_cast<ssize_t>(size());
   }
 
-  const_cast<Block::element_container&>(m_wire.elements())[i] = component;
-  m_wire.resetWire();
+  Name encoded;
+  encoded.appendEncoded(component.type(), component.value_bytes());
+  replaceEncoded(static_cast<size_t>(i), static_cast<size_t>(i) + 1, encoded.m_value);
   return *this;
 }
 
 Name&
 Name::set(ssize_t i, Component&& component)
 {
-  if (i < 0) {
-    i += static_cast<ssize_t>(size());
+  return set(i, static_cast<const Component&>(component));
+}
+
+void
+Name::appendEncoded(uint32_t type, span<const uint8_t> value)
+{
+  size_t offset = m_value.size();
+  size_t typeSize = tlv::sizeOfVarNumber(type);
+  size_t lengthSize = tlv::sizeOfVarNumber(value.size());
+  m_value.resize(offset + typeSize + lengthSize + value.size(), boost::container::default_init);
+
+  auto writeVarNumber = [] (uint8_t* pos, uint64_t number, size_t varSize) {
+    if (varSize == 1) {
+      *pos = static_cast<uint8_t>(number);
+      return;
+    }
+    *pos++ = varSize == 3 ? 253 : varSize == 5 ? 254 : 255;
+    for (size_t i = varSize - 1; i > 0; --i) {
+      pos[i - 1] = static_cast<uint8_t>(number);
+      number >>= 8;
+    }
+  };
+  uint8_t* pos = m_value.data() + offset;
+  writeVarNumber(pos, type, typeSize);
+  writeVarNumber(pos + typeSize, value.size(), lengthSize);
+  if (!value.empty()) {
+    std::memcpy(pos + typeSize + lengthSize, value.data(), value.size());
   }
 
-  const_cast<Block::element_container&>(m_wire.elements())[i] = std::move(component);
-  m_wire.resetWire();
-  return *this;
+  m_offsets.push_back(static_cast<uint32_t>(offset));
+  resetCache();
+}
+
+void
+Name::replaceEncoded(size_t first, size_t last, span<const uint8_t> encoding)
+{
+  BOOST_ASSERT(first <= last && last <= size());
+
+  size_t begin = first < size() ? m_offsets[first] : m_value.size();
+  size_t end = last < size() ? m_offsets[last] : m_value.size();
+  auto delta = static_cast<int64_t>(encoding.size()) - static_cast<int64_t>(end - begin);
+
+  // re-parse the offsets within the replacement
+  decltype(m_offsets) newOffsets;
+  for (size_t pos = 0; pos < encoding.size();) {
+    newOffsets.push_back(static_cast<uint32_t>(begin + pos));
+    auto it = encoding.begin() + pos;
+    tlv::readType(it, encoding.end());
+    uint64_t length = tlv::readVarNumber(it, encoding.end());
+    pos = static_cast<size_t>(it - encoding.begin()) + length;
+  }
+
+  m_value.erase(m_value.begin() + begin, m_value.begin() + end);
+  m_value.insert(m_value.begin() + begin, encoding.begin(), encoding.end());
+
+  for (size_t i = last; i < m_offsets.size(); ++i) {
+    m_offsets[i] = static_cast<uint32_t>(m_offsets[i] + delta);
+  }
+  m_offsets.erase(m_offsets.begin() + first, m_offsets.begin() + last);
+  m_offsets.insert(m_offsets.begin() + first, newOffsets.begin(), newOffsets.end());
+
+  resetCache();
 }
 
 Name&
@@ -221,9 +326,13 @@ Name::append(const PartialName& name)
     return append(PartialName(name));
   }
 
-  for (const auto& c : name) {
-    append(c);
+  size_t base = m_value.size();
+  m_value.insert(m_value.end(), name.m_value.begin(), name.m_value.end());
+  m_offsets.reserve(size() + name.size());
+  for (auto offset : name.m_offsets) {
+    m_offsets.push_back(static_cast<uint32_t>(base + offset));
   }
+  resetCache();
   return *this;
 }
 
@@ -244,18 +353,18 @@ Name::appendParametersSha256DigestPlaceholder()
 void
 Name::erase(ssize_t i)
 {
-  if (i >= 0) {
-    m_wire.erase(std::next(m_wire.elements_begin(), i));
-  }
-  else {
-    m_wire.erase(std::prev(m_wire.elements_end(), -i));
+  if (i < 0) {
+    i += static_cast<ssize_t>(size());
   }
+  replaceEncoded(static_cast<size_t>(i), static_cast<size_t>(i) + 1, {});
 }
 
 void
 Name::clear()
 {
-  m_wire = Block(tlv::Name);
+  m_value.clear();
+  m_offsets.clear();
+  resetCache();
 }
 
 // ---- algorithms ----
@@ -271,34 +380,25 @@ Name::getSuccessor() const
   return getPrefix(-1).append(get(-1).getSuccessor());
 }
 
+// Components are stored in canonical encoding, therefore two sequences of components are equal
+// if and only if their encodings are equal. Moreover, the lexicographical order of the encoding
+// of a component is the same as the canonical order of the component, and no encoding of a
+// component is a proper prefix of the encoding of another component. Hence, comparing the
+// concatenated encodings is equivalent to comparing the names component by component.
+
 bool
 Name::isPrefixOf(const Name& other) const noexcept
 {
-  // This name is longer than the name we are checking against.
-  if (size() > other.size())
-    return false;
-
-  // Check if at least one of given components doesn't match.
-  for (size_t i = 0; i < size(); ++i) {
-    if (get(i) != other.get(i))
-      return false;
-  }
-
-  return true;
+  return size() <= other.size() &&
+         m_value.size() <= other.m_value.size() &&
+         std::equal(m_value.begin(), m_value.end(), other.m_value.begin());
 }
 
 bool
 Name::equals(const Name& other) const noexcept
 {
-  if (size() != other.size())
-    return false;
-
-  for (size_t i = 0; i < size(); ++i) {
-    if (get(i) != other.get(i))
-      return false;
-  }
-
-  return true;
+  return size() == other.size() &&
+         std::equal(m_value.begin(), m_value.end(), other.m_value.begin(), other.m_value.end());
 }
 
 int
@@ -306,16 +406,48 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
 {
   count1 = std::min(count1, this->size() - pos1);
   count2 = std::min(count2, other.size() - pos2);
-  size_t count = std::min(count1, count2);
 
-  for (size_t i = 0; i < count; ++i) {
-    int comp = get(pos1 + i).compare(other.get(pos2 + i));
-    if (comp != 0) { // i-th component differs
-      return comp;
-    }
+  auto range = [] (const Name& name, size_t pos, size_t count) -> span<const uint8_t> {
+    if (count == 0)
+      return {};
+    size_t first = name.m_offsets[pos];
+    return {name.m_value.data() + first, name.getEndOffset(pos + count - 1) - first};
+  };
+  auto lhs = range(*this, pos1, count1);
+  auto rhs = range(other, pos2, count2);
+
+  size_t commonSize = std::min(lhs.size(), rhs.size());
+  int cmp = commonSize == 0 ? 0 : std::memcmp(lhs.data(), rhs.data(), commonSize);
+  if (cmp != 0) {
+    return cmp;
+  }
+  // one range is a prefix of the other, which implies the same for the components
+  return static_cast<int>(count1) - static_cast<int>(count2);
+}
+
+// ---- hashing ----
+
+// The hash value of a name is computed incrementally, by combining the hash value of each
+// component into that of the preceding prefix. The hash values of all prefixes are computed in
+// one pass on first use, and are discarded by every modifier together with the other caches.
+
+static size_t
+hashComponent(const uint8_t* encoding, size_t size) noexcept
+{
+  return std::hash<std::string_view>{}({reinterpret_cast<const char*>(encoding), size});
+}
+
+const std::vector<size_t>&
+Name::makeHashes() const
+{
+  auto hashes = make_shared<std::vector<size_t>>();
+  hashes->reserve(size());
+  size_t seed = 0;
+  for (size_t i = 0; i < size(); ++i) {
+    boost::hash_combine(seed, hashComponent(m_value.data() + m_offsets[i], getEndOffset(i) - m_offsets[i]));
+    hashes->push_back(seed);
   }
-  // [pos1, pos1+count) of this Name equals [pos2, pos2+count) of other Name
-  return count1 - count2;
+  return m_hashes.publish(std::move(hashes));
 }
 
 // ---- URI representation ----
@@ -328,9 +460,10 @@ Name::toUri(std::ostream& os, name::UriFormat format) const
     return;
   }
 
-  for (const auto& component : *this) {
+  // one component at a time, without creating the component objects of the whole name
+  for (size_t i = 0; i < size(); ++i) {
     os << "/";
-    component.toUri(os, format);
+    makeComponent(i).toUri(os, format);
   }
 }
 
@@ -359,7 +492,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().begin(), name.wireEncode().end());
+  return name.getHash();
 }
 
 } // namespace std
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -23,11 +23,14 @@
 #define NDN_CXX_NAME_HPP
 
 #include "ndn-cxx/name-component.hpp"
+#include "ndn-cxx/detail/cached-ptr.hpp"
 
 #include <iterator>
 #include <limits>
 #include <optional>
 
+#include <boost/container/small_vector.hpp>
+
 namespace ndn {
 
 class Name;
@@ -39,6 +42,14 @@ using PartialName = Name;
 
 /**
  * @brief Represents an absolute name.
+ *
+ * A Name stores the encodings of its components back to back in a single buffer, which is kept
+ * inline for short names, together with the offset of each component. Comparison, prefix
+ * extraction, appending, and encoding operate directly on this buffer. get(), at(), and
+ * operator[] return a single name::Component, which shares the buffer of the wire encoding.
+ * A name::Component object is created for every component only when the name is iterated;
+ * these objects remain valid until the Name is modified.
+ *
  * @sa https://docs.named-data.net/NDN-packet-spec/0.3/name.html
  */
 class Name : private boost::totally_ordered<Name>
@@ -132,7 +143,7 @@ public: // constructors, encoding, decoding
   bool
   hasWire() const noexcept
   {
-    return m_wire.hasWire();
+    return m_wire.get() != nullptr;
   }
 
   /**
@@ -170,7 +181,7 @@ public: // access
   [[nodiscard]] bool
   empty() const noexcept
   {
-    return m_wire.elements().empty();
+    return m_offsets.empty();
   }
 
   /**
@@ -179,41 +190,42 @@ public: // access
   size_t
   size() const noexcept
   {
-    return m_wire.elements_size();
+    return m_offsets.size();
   }
 
   /**
-   * @brief Returns an immutable reference to the component at the specified index.
+   * @brief Returns the component at the specified index.
    * @param i zero-based index of the component to return;
    *          if negative, it is interpreted as offset from the end of the name
    * @warning No bounds checking is performed, using an out-of-range index is undefined behavior.
+   *
+   * Only the requested component is created, from its offset in the name.
    */
-  const Component&
-  get(ssize_t i) const noexcept
+  Component
+  get(ssize_t i) const
   {
     if (i < 0) {
       i += static_cast<ssize_t>(size());
     }
-    return static_cast<const Component&>(m_wire.elements()[static_cast<size_t>(i)]);
+    return makeComponent(static_cast<size_t>(i));
   }
 
   /**
    * @brief Equivalent to get().
    */
-  const Component&
-  operator[](ssize_t i) const noexcept
+  Component
+  operator[](ssize_t i) const
   {
     return get(i);
   }
 
   /**
-   * @brief Returns an immutable reference to the component at the specified index,
-   *        with bounds checking.
+   * @brief Returns the component at the specified index, with bounds checking.
    * @param i zero-based index of the component to return;
    *          if negative, it is interpreted as offset from the end of the name
    * @throws Error The index is out of bounds.
    */
-  const Component&
+  Component
   at(ssize_t i) const;
 
   /** @brief Extracts some components as a sub-name (PartialName).
@@ -250,23 +262,24 @@ public: // iterators
   /** @brief Begin iterator.
    */
   const_iterator
-  begin() const noexcept
+  begin() const
   {
-    return reinterpret_cast<const_iterator>(m_wire.elements().data());
+    return reinterpret_cast<const_iterator>(getComponents().data());
   }
 
   /** @brief End iterator.
    */
   const_iterator
-  end() const noexcept
+  end() const
   {
-    return reinterpret_cast<const_iterator>(m_wire.elements().data() + m_wire.elements().size());
+    const auto& components = getComponents();
+    return reinterpret_cast<const_iterator>(components.data() + components.size());
   }
 
   /** @brief Reverse begin iterator.
    */
   const_reverse_iterator
-  rbegin() const noexcept
+  rbegin() const
   {
     return const_reverse_iterator(end());
   }
@@ -274,7 +287,7 @@ public: // iterators
   /** @brief Reverse end iterator.
    */
   const_reverse_iterator
-  rend() const noexcept
+  rend() const
   {
     return const_reverse_iterator(begin());
   }
@@ -307,7 +320,7 @@ public: // modifiers
   Name&
   append(const Component& component)
   {
-    m_wire.push_back(component);
+    appendEncoded(component.type(), component.value_bytes());
     return *this;
   }
 
@@ -318,7 +331,7 @@ public: // modifiers
   Name&
   append(Component&& component)
   {
-    m_wire.push_back(std::move(component));
+    appendEncoded(component.type(), component.value_bytes());
     return *this;
   }
 
@@ -339,7 +352,9 @@ public: // modifiers
   Name&
   append(span<const uint8_t> value)
   {
-    return append(Component(tlv::GenericNameComponent, value));
+    // GenericNameComponent accepts any TLV-VALUE, thus no Component needs to be constructed
+    appendEncoded(tlv::GenericNameComponent, value);
+    return *this;
   }
 
   /**
@@ -645,6 +660,36 @@ public: // algorithms
   compare(size_t pos1, size_t count1,
           const Name& other, size_t pos2 = 0, size_t count2 = npos) const;
 
+public: // hashing
+  /**
+   * @brief Return a hash value of the name.
+   *
+   * The hash values of all prefixes are computed on the first call to getHash() or
+   * getPrefixHash() after the name is modified, and are cached until the next modification.
+   * `std::hash<Name>` returns the same value.
+   */
+  size_t
+  getHash() const
+  {
+    return empty() ? 0 : getHashes().back();
+  }
+
+  /**
+   * @brief Return the hash value of a prefix of the name.
+   * @param nComponents number of components in the prefix; if greater than size(),
+   *                    the whole name is hashed
+   *
+   * The result equals `getPrefix(nComponents).getHash()`. The hash values of all prefixes are
+   * computed together and cached, so subsequent calls take constant time. This allows longest
+   * prefix match structures to probe every prefix length of a name cheaply.
+   */
+  size_t
+  getPrefixHash(size_t nComponents) const
+  {
+    nComponents = std::min(nComponents, size());
+    return nComponents == 0 ? 0 : getHashes()[nComponents - 1];
+  }
+
 private: // non-member operators
   // NOTE: the following "hidden friend" operators are available via
   //       argument-dependent lookup only and must be defined inline.
@@ -680,7 +725,92 @@ public:
   static constexpr size_t npos = std::numeric_limits<size_t>::max();
 
 private:
-  mutable Block m_wire{tlv::Name};
+  /**
+   * @brief Return the component objects, creating them if necessary.
+   *
+   * The component objects are created at most once per modification of the name, and are
+   * published atomically so that concurrent readers of a const Name do not race.
+   */
+  const Block::element_container&
+  getComponents() const
+  {
+    if (auto components = m_components.get(); components != nullptr) {
+      return *components;
+    }
+    return makeComponents();
+  }
+
+  const Block::element_container&
+  makeComponents() const;
+
+  /**
+   * @brief Return the i-th component, without creating the other component objects.
+   */
+  Component
+  makeComponent(size_t i) const;
+
+  /**
+   * @brief Return the hash values of all non-empty prefixes, computing them if necessary.
+   *
+   * The i-th element is the hash value of the first i+1 components. Like the component objects,
+   * the hash values are computed at most once per modification and are published atomically.
+   */
+  const std::vector<size_t>&
+  getHashes() const
+  {
+    if (auto hashes = m_hashes.get(); hashes != nullptr) {
+      return *hashes;
+    }
+    return makeHashes();
+  }
+
+  const std::vector<size_t>&
+  makeHashes() const;
+
+  /**
+   * @brief Return the offset of the end of the i-th component in m_value.
+   */
+  size_t
+  getEndOffset(size_t i) const noexcept
+  {
+    return i + 1 < m_offsets.size() ? m_offsets[i + 1] : m_value.size();
+  }
+
+  /**
+   * @brief Append a component of TLV-TYPE @p type and TLV-VALUE @p value.
+   * @note The component is not validated.
+   */
+  void
+  appendEncoded(uint32_t type, span<const uint8_t> value);
+
+  /**
+   * @brief Replace the encodings of components `[first, last)` with @p encoding.
+   */
+  void
+  replaceEncoded(size_t first, size_t last, span<const uint8_t> encoding);
+
+  /**
+   * @brief Invalidate the cached wire encoding, component objects, and hash values.
+   */
+  void
+  resetCache() noexcept
+  {
+    m_wire.reset();
+    m_components.reset();
+    m_hashes.reset();
+  }
+
+private:
+  /// Encodings of the components in canonical form, i.e., the TLV-VALUE of the Name element.
+  boost::container::small_vector<uint8_t, 48> m_value;
+  /// Offset of each component in m_value.
+  boost::container::small_vector<uint32_t, 8> m_offsets;
+  /// Cached wire encoding; its TLV-VALUE is identical to m_value.
+  detail::CachedPtr<Block> m_wire;
+  /// Cached component objects, which refer to the buffer of m_wire.
+  detail::CachedPtr<Block::element_container> m_components;
+  /// Cached hash values of all non-empty prefixes.
+  detail::CachedPtr<std::vector<size_t>> m_hashes;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
@@ -0,0 +1,50 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/batch-verifier.hpp"
+
+#include "ndn-cxx/security/transform/public-key.hpp"
+
+#include <openssl/err.h>
+
+namespace ndn::security::detail {
+
+bool
+BatchVerifier::verify(const InputBuffers& bufs, span<const uint8_t> sig, const transform::PublicKey& key)
+{
+  // resetting keeps the allocated context, which is reinitialized below
+  EVP_MD_CTX_reset(m_ctx);
+
+  auto pkey = reinterpret_cast<EVP_PKEY*>(key.getEvpPkey());
+  bool ok = EVP_DigestVerifyInit(m_ctx, nullptr, EVP_sha256(), nullptr, pkey) == 1;
+  for (auto buf : bufs) {
+    ok = ok && EVP_DigestVerifyUpdate(m_ctx, buf.data(), buf.size()) == 1;
+  }
+  ok = ok && EVP_DigestVerifyFinal(m_ctx, sig.data(), sig.size()) == 1;
+
+  if (!ok) {
+    // do not leave the reason of a failed verification in the error queue of this thread
+    ERR_clear_error();
+  }
+  return ok;
+}
+
+} // namespace ndn::security::detail
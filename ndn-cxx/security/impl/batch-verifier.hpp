@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_BATCH_VERIFIER_HPP
+#define NDN_CXX_SECURITY_IMPL_BATCH_VERIFIER_HPP
+
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
+
+namespace ndn::security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
+namespace detail {
+
+/**
+ * @brief Verifies many SHA-256 signatures with one reusable OpenSSL digest context.
+ *
+ * Unlike the transform pipeline (`bufferSource >> verifierFilter >> boolSink`), which
+ * allocates a new chain of filters and a new digest context for every signature, this class
+ * does not allocate after construction.
+ *
+ * This class is not thread-safe; each thread should use its own instance.
+ */
+class BatchVerifier : noncopyable
+{
+public:
+  /**
+   * @brief Verify signature @p sig of @p bufs using @p key.
+   */
+  [[nodiscard]] bool
+  verify(const InputBuffers& bufs, span<const uint8_t> sig, const transform::PublicKey& key);
+
+private:
+  EvpMdCtx m_ctx;
+};
+
+} // namespace detail
+} // namespace ndn::security
+
+#endif // NDN_CXX_SECURITY_IMPL_BATCH_VERIFIER_HPP
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/public-key-cache.hpp"
+
+#include "ndn-cxx/security/transform/public-key.hpp"
+
+#include <openssl/evp.h>
+
+namespace ndn::security::detail {
+
+PublicKeyCache::PublicKeyCache(size_t capacity)
+  : m_capacity(capacity)
+{
+  BOOST_ASSERT(m_capacity > 0);
+}
+
+PublicKeyCache::~PublicKeyCache() = default;
+
+shared_ptr<const transform::PublicKey>
+PublicKeyCache::get(span<const uint8_t> pkcs8)
+{
+  Digest digest;
+  if (EVP_Digest(pkcs8.data(), pkcs8.size(), digest.data(), nullptr, EVP_sha256(), nullptr) != 1) {
+    return nullptr;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (auto it = m_index.find(digest); it != m_index.end()) {
+      m_entries.splice(m_entries.begin(), m_entries, it->second);
+      return it->second->second;
+    }
+  }
+
+  // parse outside the lock, so that a slow parse does not block other lookups
+  auto key = make_shared<transform::PublicKey>();
+  try {
+    key->loadPkcs8(pkcs8);
+  }
+  catch (const transform::PublicKey::Error&) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (auto it = m_index.find(digest); it != m_index.end()) {
+    // another thread has inserted the same key in the meantime
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->second;
+  }
+  if (m_entries.size() >= m_capacity) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+  m_entries.emplace_front(digest, key);
+  m_index.emplace(digest, m_entries.begin());
+  return key;
+}
+
+size_t
+PublicKeyCache::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+void
+PublicKeyCache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_index.clear();
+  m_entries.clear();
+}
+
+PublicKeyCache&
+PublicKeyCache::getInstance()
+{
+  static PublicKeyCache instance(256);
+  return instance;
+}
+
+} // namespace ndn::security::detail
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_IMPL_PUBLIC_KEY_CACHE_HPP
+#define NDN_CXX_SECURITY_IMPL_PUBLIC_KEY_CACHE_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+#include <array>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace ndn::security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
+namespace detail {
+
+/**
+ * @brief Bounded cache of parsed public keys.
+ *
+ * Entries are indexed by the SHA-256 digest of the PKCS #8 encoding of the key, so that a
+ * key can be looked up without trusting the name of the certificate that carries it. When
+ * the cache is full, the least recently used entry is evicted.
+ *
+ * This class is thread-safe. The returned keys are only used for verification, which does
+ * not modify them, and thus can be shared between threads.
+ */
+class PublicKeyCache : noncopyable
+{
+public:
+  explicit
+  PublicKeyCache(size_t capacity);
+
+  ~PublicKeyCache();
+
+  /**
+   * @brief Return the parsed form of the public key @p pkcs8, parsing it on a cache miss.
+   * @retval nullptr the key cannot be parsed; failures are not cached
+   */
+  shared_ptr<const transform::PublicKey>
+  get(span<const uint8_t> pkcs8);
+
+  size_t
+  size() const;
+
+  void
+  clear();
+
+  /**
+   * @brief Return the process-wide cache used by the signature verification helpers.
+   */
+  static PublicKeyCache&
+  getInstance();
+
+private:
+  using Digest = std::array<uint8_t, 32>;
+  using Entry = std::pair<Digest, shared_ptr<const transform::PublicKey>>;
+
+  const size_t m_capacity;
+  mutable std::mutex m_mutex;
+  std::list<Entry> m_entries; ///< most recently used entry first
+  std::map<Digest, std::list<Entry>::iterator> m_index;
+};
+
+} // namespace detail
+} // namespace ndn::security
+
+#endif // NDN_CXX_SECURITY_IMPL_PUBLIC_KEY_CACHE_HPP
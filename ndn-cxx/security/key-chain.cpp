@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/merkle-tree.hpp"
 #include "ndn-cxx/security/signing-helpers.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 
@@ -216,6 +217,7 @@ KeyChain::createIdentity(const Name& identityName, const KeyParams& params)
     selfSign(key);
   }
 
+  m_signerCache.clear();
   return id;
 }
 
@@ -234,6 +236,7 @@ KeyChain::deleteIdentity(const Identity& identity)
   }
 
   m_pib->removeIdentity(identityName);
+  m_signerCache.clear();
 }
 
 void
@@ -242,6 +245,7 @@ KeyChain::setDefaultIdentity(const Identity& identity)
   BOOST_ASSERT(identity);
 
   m_pib->setDefaultIdentity(identity.getName());
+  m_signerCache.clear();
 }
 
 Key
@@ -258,6 +262,7 @@ KeyChain::createKey(const Identity& identity, const KeyParams& params)
   NDN_LOG_DEBUG("Requesting self-signing for newly created key " << key);
   selfSign(key);
 
+  m_signerCache.clear();
   return key;
 }
 
@@ -278,6 +283,7 @@ KeyChain::deleteKey(const Identity& identity, const Key& key)
   Name keyName = key.getName();
   identity.removeKey(keyName);
   m_tpm->deleteKey(keyName);
+  m_signerCache.clear();
 }
 
 void
@@ -287,6 +293,7 @@ KeyChain::setDefaultKey(const Identity& identity, const Key& key)
   BOOST_ASSERT(key);
 
   identity.setDefaultKey(key.getName());
+  m_signerCache.clear();
 }
 
 void
@@ -295,6 +302,7 @@ KeyChain::addCertificate(const Key& key, const Certificate& certificate)
   BOOST_ASSERT(key);
 
   key.addCertificate(certificate);
+  m_signerCache.clear();
 }
 
 void
@@ -303,6 +311,7 @@ KeyChain::deleteCertificate(const Key& key, const Name& certName)
   BOOST_ASSERT(key);
 
   key.removeCertificate(certName);
+  m_signerCache.clear();
 }
 
 void
@@ -311,6 +320,7 @@ KeyChain::setDefaultCertificate(const Key& key, const Certificate& cert)
   BOOST_ASSERT(key);
 
   key.setDefaultCertificate(cert);
+  m_signerCache.clear();
 }
 
 shared_ptr<SafeBag>
@@ -377,6 +387,7 @@ KeyChain::importSafeBag(const SafeBag& safeBag, const char* pw, size_t pwLen)
   Identity id = m_pib->addIdentity(identity);
   Key key = id.addKey(cert.getPublicKey(), keyName);
   key.addCertificate(cert);
+  m_signerCache.clear();
 }
 
 void
@@ -396,17 +407,111 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 
 // public: signing
 
+/**
+ * @brief Sign @p data with @p signBytes, which signs the unsigned portion of the packet.
+ *
+ * The unsigned portion is encoded into a buffer from the thread-local pool, which is recycled
+ * once the packet is signed. The signed packet retains its wire encoding, so it is assembled
+ * in a buffer of exactly the right size rather than in the pooled buffer, which can be up to
+ * twice as large and would stay in use for as long as the packet does.
+ */
+template<typename SignFunc>
+static void
+signDataPacket(Data& data, const SignFunc& signBytes)
+{
+  EncodingEstimator estimator;
+  EncodingBuffer unsignedPortion(encoding::BufferPool::getThreadLocal(),
+                                 data.wireEncode(estimator, true), 0);
+  data.wireEncode(unsignedPortion, true);
+  ConstBufferPtr sigValue = signBytes(unsignedPortion);
+
+  size_t length = unsignedPortion.size() + tlv::sizeOfVarNumber(tlv::SignatureValue) +
+                  tlv::sizeOfVarNumber(sigValue->size()) + sigValue->size();
+  size_t headerLength = tlv::sizeOfVarNumber(tlv::Data) + tlv::sizeOfVarNumber(length);
+  EncodingBuffer encoder(headerLength + length, length);
+  encoder.appendBytes(unsignedPortion);
+  data.wireEncode(encoder, *sigValue);
+}
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
   auto [keyName, sigInfo] = prepareSignatureInfo(params);
 
   data.setSignatureInfo(sigInfo);
-  EncodingBuffer encoder;
-  data.wireEncode(encoder, true);
+  signDataPacket(data, [&, &keyName = keyName] (const EncodingBuffer& unsignedPortion) {
+    return sign({unsignedPortion}, keyName, params.getDigestAlgorithm());
+  });
+}
 
-  auto sigValue = sign({encoder}, keyName, params.getDigestAlgorithm());
-  data.wireEncode(encoder, *sigValue);
+SigningContext
+KeyChain::prepareSigningContext(const SigningInfo& params)
+{
+  SigningContext ctx;
+  std::tie(ctx.m_keyName, ctx.m_sigInfo) = prepareSignatureInfo(params);
+  ctx.m_digestAlgorithm = params.getDigestAlgorithm();
+
+  // cache the encoding of SignatureInfo, which is then copied into every signed packet
+  ctx.m_sigInfo.wireEncode(SignatureInfo::Type::Data);
+
+  if (ctx.m_keyName != SigningInfo::getDigestSha256Identity()) {
+    ctx.m_keyHandle = m_tpm->findSharedKey(ctx.m_keyName);
+    if (ctx.m_keyHandle == nullptr) {
+      NDN_THROW(InvalidSigningInfoError("Private key `" + ctx.m_keyName.toUri() + "` does not exist "
+                                        "in the TPM (e.g., PIB contains info about the key, but TPM "
+                                        "is missing the corresponding private key)"));
+    }
+  }
+  return ctx;
+}
+
+void
+KeyChain::sign(Data& data, const SigningContext& ctx) const
+{
+  data.setSignatureInfo(ctx.m_sigInfo);
+  signDataPacket(data, [&] (const EncodingBuffer& unsignedPortion) {
+    return sign({unsignedPortion}, ctx);
+  });
+}
+
+void
+KeyChain::signBatch(span<Data* const> packets, const SigningInfo& params)
+{
+  signBatch(packets, prepareSigningContext(params));
+}
+
+void
+KeyChain::signBatch(span<Data* const> packets, const SigningContext& ctx) const
+{
+  if (packets.empty()) {
+    return;
+  }
+
+  SignatureInfo sigInfo = ctx.m_sigInfo;
+  sigInfo.removeCustomTlv(tlv::security::MerkleAuditPath);
+
+  std::vector<MerkleDigest> leaves;
+  leaves.reserve(packets.size());
+  for (Data* data : packets) {
+    data->setSignatureInfo(sigInfo);
+    EncodingEstimator estimator;
+    EncodingBuffer encoder(encoding::BufferPool::getThreadLocal(), data->wireEncode(estimator, true), 0);
+    data->wireEncode(encoder, true);
+    leaves.push_back(MerkleTree::computeDataLeaf(encoder));
+  }
+  MerkleTree tree(std::move(leaves));
+
+  // the signature covers SignatureInfo without MerkleAuditPath, followed by the root digest
+  const Block& sigInfoWire = sigInfo.wireEncode();
+  auto sigValue = sign({sigInfoWire, tree.getRoot()}, ctx);
+
+  for (size_t i = 0; i < packets.size(); ++i) {
+    SignatureInfo leafSigInfo = sigInfo;
+    leafSigInfo.addCustomTlv(tree.getAuditPath(i).wireEncode());
+    packets[i]->setSignatureInfo(leafSigInfo);
+    packets[i]->setSignatureValue(sigValue);
+    packets[i]->wireEncode();
+  }
 }
 
 void
@@ -601,11 +706,51 @@ KeyChain::selfSign(Key& key)
   auto cert = makeCertificate(key, signingByKey(key), opts);
 
   key.addCertificate(cert);
+  m_signerCache.clear();
   return cert;
 }
 
 std::tuple<Name, SignatureInfo>
 KeyChain::prepareSignatureInfo(const SigningInfo& params)
+{
+  switch (params.getSignerType()) {
+    case SigningInfo::SIGNER_TYPE_SHA256: {
+      return prepareSignatureInfoSha256(params);
+    }
+    case SigningInfo::SIGNER_TYPE_HMAC: {
+      return prepareSignatureInfoHmac(params, *m_tpm);
+    }
+    default:
+      break;
+  }
+
+  // resolving the signer requires several PIB lookups, so the result is cached
+  std::pair cacheKey{params.getSignerType(), params.getSignerName()};
+  auto it = m_signerCache.find(cacheKey);
+  if (it == m_signerCache.end()) {
+    if (m_signerCache.size() >= MAX_SIGNER_CACHE_SIZE) {
+      m_signerCache.clear();
+    }
+    it = m_signerCache.emplace(std::move(cacheKey), resolveSigner(params)).first;
+  }
+  const auto& signer = it->second;
+
+  if (signer.keyName == SigningInfo::getDigestSha256Identity()) {
+    return prepareSignatureInfoSha256(params);
+  }
+
+  auto sigInfo = params.getSignatureInfo();
+  sigInfo.setSignatureType(getSignatureType(signer.keyType, params.getDigestAlgorithm()));
+  if (!sigInfo.hasKeyLocator()) {
+    sigInfo.setKeyLocator(signer.keyLocator);
+  }
+
+  NDN_LOG_TRACE("Prepared signature info: " << sigInfo);
+  return {signer.keyName, sigInfo};
+}
+
+KeyChain::ResolvedSigner
+KeyChain::resolveSigner(const SigningInfo& params)
 {
   switch (params.getSignerType()) {
     case SigningInfo::SIGNER_TYPE_NULL: {
@@ -614,9 +759,9 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
         identity = m_pib->getDefaultIdentity();
       }
       catch (const Pib::Error&) { // no default identity, use sha256 for signing.
-        return prepareSignatureInfoSha256(params);
+        return {SigningInfo::getDigestSha256Identity(), KeyType::NONE, {}};
       }
-      return prepareSignatureInfoWithIdentity(params, identity);
+      return resolveSignerWithIdentity(identity);
     }
     case SigningInfo::SIGNER_TYPE_ID: {
       auto identity = params.getPibIdentity();
@@ -633,7 +778,7 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
       if (!identity) {
         NDN_THROW(InvalidSigningInfoError("Cannot determine signing parameters"));
       }
-      return prepareSignatureInfoWithIdentity(params, identity);
+      return resolveSignerWithIdentity(identity);
     }
     case SigningInfo::SIGNER_TYPE_KEY: {
       auto key = params.getPibKey();
@@ -651,7 +796,7 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
       if (!key) {
         NDN_THROW(InvalidSigningInfoError("Cannot determine signing parameters"));
       }
-      return prepareSignatureInfoWithKey(params, key);
+      return resolveSignerWithKey(key);
     }
     case SigningInfo::SIGNER_TYPE_CERT: {
       auto certName = params.getSignerName();
@@ -665,14 +810,10 @@ KeyChain::prepareSignatureInfo(const SigningInfo& params)
         NDN_THROW_NESTED(InvalidSigningInfoError("Signing certificate `" +
                                                  certName.toUri() + "` does not exist"));
       }
-      return prepareSignatureInfoWithKey(params, key, certName);
-    }
-    case SigningInfo::SIGNER_TYPE_SHA256: {
-      return prepareSignatureInfoSha256(params);
-    }
-    case SigningInfo::SIGNER_TYPE_HMAC: {
-      return prepareSignatureInfoHmac(params, *m_tpm);
+      return resolveSignerWithKey(key, certName);
     }
+    default:
+      break;
   }
   NDN_THROW(InvalidSigningInfoError("Unrecognized signer type " +
                                     to_string(params.getSignerType())));
@@ -704,8 +845,8 @@ KeyChain::prepareSignatureInfoHmac(const SigningInfo& params, Tpm& tpm)
   return {keyName, sigInfo};
 }
 
-std::tuple<Name, SignatureInfo>
-KeyChain::prepareSignatureInfoWithIdentity(const SigningInfo& params, const pib::Identity& identity)
+KeyChain::ResolvedSigner
+KeyChain::resolveSignerWithIdentity(const pib::Identity& identity)
 {
   pib::Key key;
   try {
@@ -715,32 +856,25 @@ KeyChain::prepareSignatureInfoWithIdentity(const SigningInfo& params, const pib:
     NDN_THROW_NESTED(InvalidSigningInfoError("Signing identity `" + identity.getName().toUri() +
                                               "` does not have a default key"));
   }
-  return prepareSignatureInfoWithKey(params, key);
+  return resolveSignerWithKey(key);
 }
 
-std::tuple<Name, SignatureInfo>
-KeyChain::prepareSignatureInfoWithKey(const SigningInfo& params, const pib::Key& key,
-                                      const std::optional<Name>& certName)
+KeyChain::ResolvedSigner
+KeyChain::resolveSignerWithKey(const pib::Key& key, const std::optional<Name>& certName)
 {
-  auto sigInfo = params.getSignatureInfo();
-  sigInfo.setSignatureType(getSignatureType(key.getKeyType(), params.getDigestAlgorithm()));
-  if (!sigInfo.hasKeyLocator()) {
-    if (certName) {
-      sigInfo.setKeyLocator(certName);
+  Name klName;
+  if (certName) {
+    klName = *certName;
+  }
+  else {
+    klName = key.getName();
+    try {
+      klName = key.getDefaultCertificate().getName();
     }
-    else {
-      Name klName = key.getName();
-      try {
-        klName = key.getDefaultCertificate().getName();
-      }
-      catch (const Pib::Error&) {
-      }
-      sigInfo.setKeyLocator(klName);
+    catch (const Pib::Error&) {
     }
   }
-
-  NDN_LOG_TRACE("Prepared signature info: " << sigInfo);
-  return {key.getName(), sigInfo};
+  return {key.getName(), key.getKeyType(), klName};
 }
 
 ConstBufferPtr
@@ -764,6 +898,25 @@ KeyChain::sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm di
   return signature;
 }
 
+ConstBufferPtr
+KeyChain::sign(const InputBuffers& bufs, const SigningContext& ctx)
+{
+  using namespace transform;
+
+  if (ctx.m_keyHandle == nullptr) {
+    OBufferStream os;
+    bufferSource(bufs) >> digestFilter(DigestAlgorithm::SHA256) >> streamSink(os);
+    return os.buf();
+  }
+
+  auto signature = ctx.m_keyHandle->sign(ctx.m_digestAlgorithm, bufs);
+  if (!signature) {
+    NDN_THROW(Error("Failed to sign with key `" + ctx.m_keyName.toUri() + "`"));
+  }
+
+  return signature;
+}
+
 tlv::SignatureTypeValue
 KeyChain::getSignatureType(KeyType keyType, DigestAlgorithm)
 {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -30,6 +30,8 @@
 #include "ndn-cxx/security/signing-info.hpp"
 #include "ndn-cxx/security/tpm/tpm.hpp"
 
+#include <map>
+
 /**
  * @brief Contains the ndn-cxx security framework.
  */
@@ -75,6 +77,46 @@ struct MakeCertificateOptions
   std::optional<ValidityPeriod> validity;
 };
 
+class KeyChain;
+
+/**
+ * @brief Signing parameters resolved by KeyChain::prepareSigningContext().
+ *
+ * A SigningContext contains the signing key name, the SignatureInfo, and the digest algorithm
+ * that KeyChain::sign() would derive from a SigningInfo, as well as the private key loaded from
+ * the TPM. Signing many packets with the same SigningContext avoids repeating the PIB and TPM
+ * lookups for each packet.
+ */
+class SigningContext
+{
+public:
+  const Name&
+  getKeyName() const noexcept
+  {
+    return m_keyName;
+  }
+
+  const SignatureInfo&
+  getSignatureInfo() const noexcept
+  {
+    return m_sigInfo;
+  }
+
+  DigestAlgorithm
+  getDigestAlgorithm() const noexcept
+  {
+    return m_digestAlgorithm;
+  }
+
+private:
+  Name m_keyName;
+  SignatureInfo m_sigInfo;
+  DigestAlgorithm m_digestAlgorithm = DigestAlgorithm::NONE;
+  shared_ptr<const tpm::KeyHandle> m_keyHandle; ///< nullptr when signing with DigestSha256
+
+  friend KeyChain;
+};
+
 /**
  * @brief The main interface for signing key management.
  *
@@ -299,6 +341,55 @@ public: // signing
   void
   sign(Data& data, const SigningInfo& params = SigningInfo());
 
+  /**
+   * @brief Resolve the supplied signing information into a SigningContext.
+   *
+   * The private key is loaded from the TPM into the SigningContext, so that subsequent calls
+   * to sign(Data&, const SigningContext&) do not access the KeyChain. The SigningContext keeps
+   * the private key usable even if the key is deleted from the KeyChain in the meantime.
+   *
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                certificate, or private key does not exist
+   */
+  SigningContext
+  prepareSigningContext(const SigningInfo& params = SigningInfo());
+
+  /**
+   * @brief Sign a Data packet with a SigningContext obtained from prepareSigningContext().
+   *
+   * Unlike other KeyChain methods, this method may be invoked concurrently from multiple
+   * threads, even while the KeyChain is being used or modified by another thread.
+   *
+   * @throw Error Signing failed
+   */
+  void
+  sign(Data& data, const SigningContext& ctx) const;
+
+  /**
+   * @brief Sign a batch of Data packets with a single signature.
+   *
+   * A Merkle tree is built over the packets in @p packets, and only its root is signed with the
+   * key selected by @p params. Each packet receives the same SignatureValue, and a SignatureInfo
+   * that contains its MerkleAuditPath in addition to the elements generated by sign().
+   * These packets can be verified with the usual verification helpers and Validator.
+   *
+   * @throw Error Signing failed
+   * @throw InvalidSigningInfoError Invalid @p params was specified or the specified identity, key,
+   *                                or certificate does not exist
+   * @sa <a href="../specs/merkle-signature.html">Merkle Batch Signature</a>
+   */
+  void
+  signBatch(span<Data* const> packets, const SigningInfo& params = SigningInfo());
+
+  /**
+   * @brief Sign a batch of Data packets with a SigningContext obtained from prepareSigningContext().
+   *
+   * This method may be invoked concurrently from multiple threads, under the same conditions as
+   * sign(Data&, const SigningContext&).
+   */
+  void
+  signBatch(span<Data* const> packets, const SigningContext& ctx) const;
+
   /**
    * @brief Sign an Interest according to the supplied signing information.
    *
@@ -493,12 +584,31 @@ private: // signing
   static std::tuple<Name, SignatureInfo>
   prepareSignatureInfoHmac(const SigningInfo& params, Tpm& tpm);
 
-  static std::tuple<Name, SignatureInfo>
-  prepareSignatureInfoWithIdentity(const SigningInfo& params, const pib::Identity& identity);
+  /**
+   * @brief Signing key and KeyLocator name selected by a SigningInfo.
+   */
+  struct ResolvedSigner
+  {
+    Name keyName;
+    KeyType keyType;
+    Name keyLocator;
+  };
 
-  static std::tuple<Name, SignatureInfo>
-  prepareSignatureInfoWithKey(const SigningInfo& params, const pib::Key& key,
-                              const std::optional<Name>& certName = std::nullopt);
+  /**
+   * @brief Look up the signing key and certificate in the PIB.
+   *
+   * SigningInfo::SIGNER_TYPE_SHA256 is represented by SigningInfo::getDigestSha256Identity().
+   *
+   * @throw InvalidSigningInfoError The requested signing method cannot be satisfied
+   */
+  ResolvedSigner
+  resolveSigner(const SigningInfo& params);
+
+  static ResolvedSigner
+  resolveSignerWithIdentity(const pib::Identity& identity);
+
+  static ResolvedSigner
+  resolveSignerWithKey(const pib::Key& key, const std::optional<Name>& certName = std::nullopt);
 
   /**
    * @brief Generate and return a raw signature for the byte ranges in @p bufs using
@@ -507,10 +617,25 @@ private: // signing
   ConstBufferPtr
   sign(const InputBuffers& bufs, const Name& keyName, DigestAlgorithm digestAlgorithm) const;
 
+  /**
+   * @brief Generate and return a raw signature for the byte ranges in @p bufs using
+   *        the private key held by @p ctx.
+   */
+  static ConstBufferPtr
+  sign(const InputBuffers& bufs, const SigningContext& ctx);
+
 private:
   unique_ptr<Pib> m_pib;
   unique_ptr<Tpm> m_tpm;
 
+  /**
+   * @brief Signers resolved by prepareSignatureInfo(), keyed by signer type and name.
+   *
+   * The PIB can only be modified through KeyChain, which clears the cache on every modification.
+   */
+  std::map<std::pair<SigningInfo::SignerType, Name>, ResolvedSigner> m_signerCache;
+  static constexpr size_t MAX_SIGNER_CACHE_SIZE = 64;
+
   static Locator s_defaultPibLocator;
   static Locator s_defaultTpmLocator;
 };
@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/merkle-tree.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
+
+namespace ndn::security {
+
+constexpr uint8_t LEAF_PREFIX = 0x00;
+constexpr uint8_t NODE_PREFIX = 0x01;
+
+static MerkleDigest
+computeDigest(uint8_t prefix, std::initializer_list<span<const uint8_t>> bufs)
+{
+  detail::EvpMdCtx ctx;
+  MerkleDigest digest;
+  unsigned int digestLen = 0;
+
+  bool ok = EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr) == 1 &&
+            EVP_DigestUpdate(ctx, &prefix, sizeof(prefix)) == 1;
+  for (auto buf : bufs) {
+    ok = ok && EVP_DigestUpdate(ctx, buf.data(), buf.size()) == 1;
+  }
+  ok = ok && EVP_DigestFinal_ex(ctx, digest.data(), &digestLen) == 1;
+  if (!ok || digestLen != digest.size()) {
+    NDN_THROW(std::runtime_error("SHA-256 computation failed"));
+  }
+  return digest;
+}
+
+MerkleAuditPath::MerkleAuditPath(uint64_t leafIndex, uint64_t leafCount,
+                                 std::vector<MerkleDigest> siblings)
+  : m_leafIndex(leafIndex)
+  , m_leafCount(leafCount)
+  , m_siblings(std::move(siblings))
+{
+}
+
+MerkleAuditPath::MerkleAuditPath(const Block& block)
+{
+  wireDecode(block);
+}
+
+std::optional<MerkleDigest>
+MerkleAuditPath::computeRoot(const MerkleDigest& leaf) const
+{
+  if (m_leafIndex >= m_leafCount) {
+    return std::nullopt;
+  }
+
+  MerkleDigest node = leaf;
+  auto sibling = m_siblings.begin();
+  uint64_t index = m_leafIndex;
+  uint64_t count = m_leafCount;
+  for (; count > 1; index /= 2, count = (count + 1) / 2) {
+    if (index % 2 == 1) {
+      if (sibling == m_siblings.end()) {
+        return std::nullopt;
+      }
+      node = MerkleTree::computeNode(*sibling++, node);
+    }
+    else if (index + 1 < count) {
+      if (sibling == m_siblings.end()) {
+        return std::nullopt;
+      }
+      node = MerkleTree::computeNode(node, *sibling++);
+    }
+    // otherwise, the node is promoted to the next level
+  }
+
+  if (sibling != m_siblings.end()) {
+    return std::nullopt;
+  }
+  return node;
+}
+
+template<encoding::Tag TAG>
+size_t
+MerkleAuditPath::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  size_t totalLength = 0;
+
+  for (auto it = m_siblings.rbegin(); it != m_siblings.rend(); ++it) {
+    totalLength += prependBinaryBlock(encoder, tlv::security::MerkleSibling, *it);
+  }
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::security::MerkleLeafCount, m_leafCount);
+  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::security::MerkleLeafIndex, m_leafIndex);
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::security::MerkleAuditPath);
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(MerkleAuditPath);
+
+const Block&
+MerkleAuditPath::wireEncode() const
+{
+  if (m_wire.hasWire())
+    return m_wire;
+
+  EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  m_wire = buffer.block();
+  return m_wire;
+}
+
+void
+MerkleAuditPath::wireDecode(const Block& wire)
+{
+  if (wire.type() != tlv::security::MerkleAuditPath) {
+    NDN_THROW(Error("MerkleAuditPath", wire.type()));
+  }
+  m_wire = wire;
+  m_wire.parse();
+
+  m_siblings.clear();
+
+  auto it = m_wire.elements_begin();
+  if (it == m_wire.elements_end() || it->type() != tlv::security::MerkleLeafIndex) {
+    NDN_THROW(Error("Missing MerkleLeafIndex element"));
+  }
+  m_leafIndex = readNonNegativeInteger(*it);
+
+  ++it;
+  if (it == m_wire.elements_end() || it->type() != tlv::security::MerkleLeafCount) {
+    NDN_THROW(Error("Missing MerkleLeafCount element"));
+  }
+  m_leafCount = readNonNegativeInteger(*it);
+  if (m_leafIndex >= m_leafCount) {
+    NDN_THROW(Error("MerkleLeafIndex must be less than MerkleLeafCount"));
+  }
+
+  for (++it; it != m_wire.elements_end(); ++it) {
+    if (it->type() != tlv::security::MerkleSibling) {
+      NDN_THROW(Error("Unexpected element of type " + std::to_string(it->type()) +
+                      " in MerkleAuditPath"));
+    }
+    if (it->value_size() != std::tuple_size_v<MerkleDigest>) {
+      NDN_THROW(Error("MerkleSibling must be " + std::to_string(std::tuple_size_v<MerkleDigest>) +
+                      " octets long"));
+    }
+    auto& sibling = m_siblings.emplace_back();
+    std::copy(it->value_begin(), it->value_end(), sibling.begin());
+  }
+}
+
+MerkleTree::MerkleTree(std::vector<MerkleDigest> leaves)
+{
+  if (leaves.empty()) {
+    NDN_THROW(std::invalid_argument("MerkleTree must have at least one leaf"));
+  }
+
+  m_levels.push_back(std::move(leaves));
+  while (m_levels.back().size() > 1) {
+    const auto& level = m_levels.back();
+    std::vector<MerkleDigest> parents;
+    parents.reserve((level.size() + 1) / 2);
+    for (size_t i = 0; i + 1 < level.size(); i += 2) {
+      parents.push_back(computeNode(level[i], level[i + 1]));
+    }
+    if (level.size() % 2 == 1) {
+      parents.push_back(level.back());
+    }
+    m_levels.push_back(std::move(parents));
+  }
+}
+
+MerkleAuditPath
+MerkleTree::getAuditPath(size_t leafIndex) const
+{
+  if (leafIndex >= getLeafCount()) {
+    NDN_THROW(std::out_of_range("Leaf index out of range"));
+  }
+
+  std::vector<MerkleDigest> siblings;
+  size_t index = leafIndex;
+  for (size_t i = 0; i + 1 < m_levels.size(); ++i, index /= 2) {
+    size_t siblingIndex = index ^ 1;
+    if (siblingIndex < m_levels[i].size()) {
+      siblings.push_back(m_levels[i][siblingIndex]);
+    }
+  }
+  return {leafIndex, getLeafCount(), std::move(siblings)};
+}
+
+MerkleDigest
+MerkleTree::computeDataLeaf(span<const uint8_t> signedPortion)
+{
+  // find the beginning of SignatureInfo, which follows Name, MetaInfo, and Content
+  auto pos = signedPortion.begin();
+  const auto end = signedPortion.end();
+  while (pos != end) {
+    auto elementBegin = pos;
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length) ||
+        length > static_cast<uint64_t>(std::distance(pos, end))) {
+      NDN_THROW(tlv::Error("Malformed TLV element in Data packet"));
+    }
+    if (type == tlv::SignatureInfo) {
+      auto leafData = signedPortion.first(static_cast<size_t>(elementBegin - signedPortion.begin()));
+      return computeDigest(LEAF_PREFIX, {leafData});
+    }
+    pos += length;
+  }
+  NDN_THROW(tlv::Error("SignatureInfo element not found in Data packet"));
+}
+
+MerkleDigest
+MerkleTree::computeNode(const MerkleDigest& left, const MerkleDigest& right)
+{
+  return computeDigest(NODE_PREFIX, {left, right});
+}
+
+} // namespace ndn::security
@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_MERKLE_TREE_HPP
+#define NDN_CXX_SECURITY_MERKLE_TREE_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/tlv-security.hpp"
+
+#include <array>
+#include <optional>
+
+namespace ndn::security {
+
+/**
+ * @brief SHA-256 digest of a node in a MerkleTree.
+ */
+using MerkleDigest = std::array<uint8_t, 32>;
+
+/**
+ * @brief Represents a %MerkleAuditPath TLV element.
+ *
+ * The audit path of a leaf contains the digests of the siblings of all nodes on the path from
+ * the leaf to the root of a MerkleTree, from the bottom up. Together with the position of the
+ * leaf and the number of leaves, it allows recomputing the root digest from the leaf digest.
+ *
+ *     MerkleAuditPath = MERKLE-AUDIT-PATH-TYPE TLV-LENGTH
+ *                         MerkleLeafIndex
+ *                         MerkleLeafCount
+ *                         *MerkleSibling
+ *
+ *     MerkleLeafIndex = MERKLE-LEAF-INDEX-TYPE TLV-LENGTH NonNegativeInteger
+ *     MerkleLeafCount = MERKLE-LEAF-COUNT-TYPE TLV-LENGTH NonNegativeInteger
+ *     MerkleSibling = MERKLE-SIBLING-TYPE TLV-LENGTH 32OCTET
+ */
+class MerkleAuditPath : private boost::equality_comparable<MerkleAuditPath>
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  MerkleAuditPath() = default;
+
+  MerkleAuditPath(uint64_t leafIndex, uint64_t leafCount, std::vector<MerkleDigest> siblings);
+
+  /**
+   * @brief Create MerkleAuditPath from @p block
+   */
+  explicit
+  MerkleAuditPath(const Block& block);
+
+  uint64_t
+  getLeafIndex() const noexcept
+  {
+    return m_leafIndex;
+  }
+
+  uint64_t
+  getLeafCount() const noexcept
+  {
+    return m_leafCount;
+  }
+
+  const std::vector<MerkleDigest>&
+  getSiblings() const noexcept
+  {
+    return m_siblings;
+  }
+
+  /**
+   * @brief Compute the root digest of the tree that contains a leaf with digest @p leaf
+   *        at the position described by this audit path.
+   * @retval nullopt The number of siblings is inconsistent with the position of the leaf.
+   */
+  std::optional<MerkleDigest>
+  computeRoot(const MerkleDigest& leaf) const;
+
+  /** @brief Fast encoding or block size estimation
+   */
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder) const;
+
+  /** @brief Encode MerkleAuditPath into TLV block
+   */
+  const Block&
+  wireEncode() const;
+
+  /** @brief Decode MerkleAuditPath from TLV block
+   *  @throw Error when an invalid TLV block supplied
+   */
+  void
+  wireDecode(const Block& wire);
+
+private: // non-member operators
+  // NOTE: the following "hidden friend" operators are available via
+  //       argument-dependent lookup only and must be defined inline.
+  // boost::equality_comparable provides != operator.
+
+  friend bool
+  operator==(const MerkleAuditPath& lhs, const MerkleAuditPath& rhs)
+  {
+    return lhs.m_leafIndex == rhs.m_leafIndex &&
+           lhs.m_leafCount == rhs.m_leafCount &&
+           lhs.m_siblings == rhs.m_siblings;
+  }
+
+private:
+  uint64_t m_leafIndex = 0;
+  uint64_t m_leafCount = 0;
+  std::vector<MerkleDigest> m_siblings;
+
+  mutable Block m_wire;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(MerkleAuditPath);
+
+/**
+ * @brief Binary hash tree over a batch of packets, used for signing the batch with a single
+ *        signature.
+ *
+ * Leaf digests are `SHA-256(0x00 || leaf-data)` and interior node digests are
+ * `SHA-256(0x01 || left || right)`. When a level has an odd number of nodes, its last node is
+ * promoted to the next level unchanged.
+ *
+ * @sa KeyChain::signBatch()
+ */
+class MerkleTree
+{
+public:
+  /**
+   * @brief Build the tree over the specified leaf digests.
+   * @throw std::invalid_argument @p leaves is empty
+   */
+  explicit
+  MerkleTree(std::vector<MerkleDigest> leaves);
+
+  size_t
+  getLeafCount() const noexcept
+  {
+    return m_levels.front().size();
+  }
+
+  const MerkleDigest&
+  getRoot() const noexcept
+  {
+    return m_levels.back().front();
+  }
+
+  /**
+   * @brief Return the audit path of the leaf at @p leafIndex.
+   * @throw std::out_of_range @p leafIndex is not less than getLeafCount()
+   */
+  MerkleAuditPath
+  getAuditPath(size_t leafIndex) const;
+
+  /**
+   * @brief Compute the leaf digest of a Data packet.
+   * @param signedPortion The TLV elements of the Data packet from Name up to and including
+   *                      SignatureInfo, as returned by Data::extractSignedRanges().
+   *
+   * The leaf digest covers the Name, MetaInfo, and Content elements, but not SignatureInfo,
+   * because the latter contains the audit path of the packet.
+   *
+   * @throw tlv::Error @p signedPortion does not contain a SignatureInfo element
+   */
+  static MerkleDigest
+  computeDataLeaf(span<const uint8_t> signedPortion);
+
+  /**
+   * @brief Compute the digest of an interior node from the digests of its children.
+   */
+  static MerkleDigest
+  computeNode(const MerkleDigest& left, const MerkleDigest& right);
+
+private:
+  std::vector<std::vector<MerkleDigest>> m_levels; ///< from the leaves up to the root
+};
+
+} // namespace ndn::security
+
+#endif // NDN_CXX_SECURITY_MERKLE_TREE_HPP
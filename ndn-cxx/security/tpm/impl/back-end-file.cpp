@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -32,6 +32,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <unordered_map>
 
 #include <boost/lexical_cast.hpp>
 
@@ -79,6 +80,10 @@ public:
     return m_keystorePath / (os.str() + ".privkey");
   }
 
+public:
+  /// Private keys that have been loaded from, or saved to, the key directory.
+  std::unordered_map<Name, shared_ptr<PrivateKey>> keyCache;
+
 private:
   fs::path m_keystorePath;
 };
@@ -100,11 +105,15 @@ BackEndFile::getScheme()
 bool
 BackEndFile::doHasKey(const Name& keyName) const
 {
+  if (m_impl->keyCache.count(keyName) > 0)
+    return true;
+
   if (!fs::exists(m_impl->toFileName(keyName)))
     return false;
 
+  // the key is loaded to check that the file is valid, and kept for subsequent operations
   try {
-    loadKey(keyName);
+    m_impl->keyCache.emplace(keyName, loadKey(keyName));
     return true;
   }
   catch (const std::runtime_error&) {
@@ -118,7 +127,7 @@ BackEndFile::doGetKeyHandle(const Name& keyName) const
   if (!doHasKey(keyName))
     return nullptr;
 
-  return make_unique<KeyHandleMem>(loadKey(keyName));
+  return make_unique<KeyHandleMem>(m_impl->keyCache.at(keyName));
 }
 
 unique_ptr<KeyHandle>
@@ -141,6 +150,7 @@ BackEndFile::doCreateKey(const Name& identityName, const KeyParams& params)
 
   try {
     saveKey(keyName, *key);
+    m_impl->keyCache[keyName] = std::move(key);
     return keyHandle;
   }
   catch (const std::runtime_error&) {
@@ -151,6 +161,8 @@ BackEndFile::doCreateKey(const Name& identityName, const KeyParams& params)
 void
 BackEndFile::doDeleteKey(const Name& keyName)
 {
+  m_impl->keyCache.erase(keyName);
+
   auto keyPath = m_impl->toFileName(keyName);
   if (!fs::exists(keyPath))
     return;
@@ -166,12 +178,17 @@ BackEndFile::doDeleteKey(const Name& keyName)
 ConstBufferPtr
 BackEndFile::doExportKey(const Name& keyName, const char* pw, size_t pwLen)
 {
-  unique_ptr<PrivateKey> key;
-  try {
-    key = loadKey(keyName);
+  shared_ptr<PrivateKey> key;
+  if (auto it = m_impl->keyCache.find(keyName); it != m_impl->keyCache.end()) {
+    key = it->second;
   }
-  catch (const PrivateKey::Error&) {
-    NDN_THROW_NESTED(Error("Cannot export private key"));
+  else {
+    try {
+      key = loadKey(keyName);
+    }
+    catch (const PrivateKey::Error&) {
+      NDN_THROW_NESTED(Error("Cannot export private key"));
+    }
   }
 
   OBufferStream os;
@@ -183,9 +200,10 @@ void
 BackEndFile::doImportKey(const Name& keyName, span<const uint8_t> pkcs8, const char* pw, size_t pwLen)
 {
   try {
-    PrivateKey key;
-    key.loadPkcs8(pkcs8, pw, pwLen);
-    saveKey(keyName, key);
+    auto key = make_shared<PrivateKey>();
+    key->loadPkcs8(pkcs8, pw, pwLen);
+    saveKey(keyName, *key);
+    m_impl->keyCache[keyName] = std::move(key);
   }
   catch (const PrivateKey::Error&) {
     NDN_THROW_NESTED(Error("Cannot import private key"));
@@ -197,6 +215,7 @@ BackEndFile::doImportKey(const Name& keyName, shared_ptr<transform::PrivateKey>
 {
   try {
     saveKey(keyName, *key);
+    m_impl->keyCache[keyName] = std::move(key);
   }
   catch (const PrivateKey::Error&) {
     NDN_THROW_NESTED(Error("Cannot import private key"));
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -37,6 +37,10 @@ namespace tpm {
  *
  * In this TPM, each private key is stored in a separate file with permission 0400, i.e.,
  * owner read-only.  The key is stored in PKCS #1 format in base64 encoding.
+ *
+ * Each key is parsed at most once: keys that have been loaded, created, or imported are
+ * kept in memory until they are deleted through this back-end instance.  Changes made to
+ * the key directory by other processes are therefore not seen for cached keys.
  */
 class BackEndFile final : public BackEnd
 {
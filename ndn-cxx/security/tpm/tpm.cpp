@@ -124,4 +124,13 @@ Tpm::findKey(const Name& keyName) const
   return key;
 }
 
+shared_ptr<const KeyHandle>
+Tpm::findSharedKey(const Name& keyName) const
+{
+  if (findKey(keyName) == nullptr)
+    return nullptr;
+
+  return m_keys.at(keyName);
+}
+
 } // namespace ndn::security::tpm
@@ -210,11 +210,21 @@ private:
   const KeyHandle*
   findKey(const Name& keyName) const;
 
+  /**
+   * @brief Internal KeyHandle lookup that shares ownership of the handle.
+   *
+   * The returned handle remains usable after the key has been removed from the cache.
+   *
+   * @return The handle of key @p keyName if it exists, otherwise nullptr.
+   */
+  shared_ptr<const KeyHandle>
+  findSharedKey(const Name& keyName) const;
+
 private:
   const std::string m_locator;
   const unique_ptr<BackEnd> m_backEnd;
 
-  mutable std::unordered_map<Name, unique_ptr<KeyHandle>> m_keys;
+  mutable std::unordered_map<Name, shared_ptr<KeyHandle>> m_keys;
 
   friend KeyChain;
 };
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -26,7 +26,13 @@
 #include "ndn-cxx/encoding/buffer.hpp"
 #include "ndn-cxx/security/security-common.hpp"
 
-namespace ndn::security::transform {
+namespace ndn::security {
+
+namespace detail {
+class BatchVerifier;
+} // namespace detail
+
+namespace transform {
 
 /**
  * @brief Abstraction of a public key in crypto transformations.
@@ -108,6 +114,7 @@ public:
 
 private:
   friend class VerifierFilter;
+  friend class detail::BatchVerifier;
 
   /**
    * @return A pointer to an OpenSSL EVP_PKEY instance.
@@ -128,6 +135,7 @@ private:
   const unique_ptr<Impl> m_impl;
 };
 
-} // namespace ndn::security::transform
+} // namespace transform
+} // namespace ndn::security
 
 #endif // NDN_CXX_SECURITY_TRANSFORM_PUBLIC_KEY_HPP
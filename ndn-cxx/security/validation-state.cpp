@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -49,23 +49,22 @@ ValidationState::addCertificate(const Certificate& cert)
   m_certificateChain.push_front(cert);
 }
 
-const Certificate*
-ValidationState::verifyCertificateChain(const Certificate& trustedCert)
+bool
+ValidationState::applyCertificateChainResult(size_t nVerified)
 {
-  const Certificate* validatedCert = &trustedCert;
-  for (auto it = m_certificateChain.begin(); it != m_certificateChain.end(); ++it) {
-    const auto& certToValidate = *it;
-
-    if (!verifySignature(certToValidate, *validatedCert)) {
-      this->fail({ValidationError::INVALID_SIGNATURE, "Certificate " + certToValidate.getName().toUri()});
-      m_certificateChain.erase(it, m_certificateChain.end());
-      return nullptr;
-    }
+  BOOST_ASSERT(nVerified <= m_certificateChain.size());
 
-    NDN_LOG_TRACE_DEPTH("OK signature for certificate `" << certToValidate.getName() << "`");
-    validatedCert = &certToValidate;
+  auto it = m_certificateChain.begin();
+  for (size_t i = 0; i < nVerified; ++i, ++it) {
+    NDN_LOG_TRACE_DEPTH("OK signature for certificate `" << it->getName() << "`");
+  }
+  if (it == m_certificateChain.end()) {
+    return true;
   }
-  return validatedCert;
+
+  this->fail({ValidationError::INVALID_SIGNATURE, "Certificate " + it->getName().toUri()});
+  m_certificateChain.erase(it, m_certificateChain.end());
+  return false;
 }
 
 /////// DataValidationState
@@ -89,10 +88,18 @@ DataValidationState::~DataValidationState()
   }
 }
 
+std::function<bool(const std::optional<Certificate>&)>
+DataValidationState::getOriginalPacketVerifier() const
+{
+  return [data = m_data] (const std::optional<Certificate>& trustedCert) {
+    return verifySignature(data, trustedCert);
+  };
+}
+
 void
-DataValidationState::verifyOriginalPacket(const std::optional<Certificate>& trustedCert)
+DataValidationState::finishValidation(bool isSignatureValid)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  if (isSignatureValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -142,10 +149,18 @@ InterestValidationState::~InterestValidationState()
   }
 }
 
+std::function<bool(const std::optional<Certificate>&)>
+InterestValidationState::getOriginalPacketVerifier() const
+{
+  return [interest = m_interest] (const std::optional<Certificate>& trustedCert) {
+    return verifySignature(interest, trustedCert);
+  };
+}
+
 void
-InterestValidationState::verifyOriginalPacket(const std::optional<Certificate>& trustedCert)
+InterestValidationState::finishValidation(bool isSignatureValid)
 {
-  if (verifySignature(m_interest, trustedCert)) {
+  if (isSignatureValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for interest `" << m_interest.getName() << "`");
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
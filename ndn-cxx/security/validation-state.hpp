@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -102,14 +102,22 @@ public:
 
 private: // Interface intended to be used only by Validator class
   /**
-   * @brief Verify signature of the original packet
+   * @brief Return a function that verifies the signature of the original packet
    *
-   * @param trustedCert The certificate that signs the original packet, nullopt if certificate
-   *                    is not needed for verification (e.g., sha256 digest or attribute based
-   *                    signature)
+   * The returned function works on a copy of the original packet and does not access this
+   * state, therefore it can be invoked on a worker thread.  Its parameter is the certificate
+   * that signs the original packet, or nullopt if a certificate is not needed for verification
+   * (e.g., sha256 digest or attribute based signature).
+   */
+  virtual std::function<bool(const std::optional<Certificate>&)>
+  getOriginalPacketVerifier() const = 0;
+
+  /**
+   * @brief Call the success or failure callback of the original packet, depending on whether
+   *        its signature is valid
    */
   virtual void
-  verifyOriginalPacket(const std::optional<Certificate>& trustedCert) = 0;
+  finishValidation(bool isSignatureValid) = 0;
 
   /**
    * @brief Call success callback of the original packet without signature validation
@@ -118,21 +126,19 @@ private: // Interface intended to be used only by Validator class
   bypassValidation() = 0;
 
   /**
-   * @brief Verify signatures of certificates in the certificate chain
+   * @brief Apply the outcome of verifying the signatures of the certificate chain
    *
-   * When certificate chain cannot be verified, this method will call this->fail() with
+   * When the certificate chain is not fully verified, this method will call this->fail() with
    * INVALID_SIGNATURE error code and the appropriate diagnostic message.
    *
-   * @retval nullptr Signatures of at least one certificate in the chain is invalid.  All unverified
-   *                 certificates have been removed from m_certificateChain.
-   * @retval Certificate to validate original data packet, either m_certificateChain.back() or
-   *         trustedCert if the certificate chain is empty.
+   * @param nVerified Number of certificates at the beginning of m_certificateChain whose
+   *                  signatures are valid.
+   * @return Whether the whole certificate chain is verified.
    *
-   * @post m_certificateChain includes a list of certificates successfully verified by
-   *       @p trustedCert.
+   * @post m_certificateChain includes only the @p nVerified verified certificates.
    */
-  const Certificate*
-  verifyCertificateChain(const Certificate& trustedCert);
+  bool
+  applyCertificateChainResult(size_t nVerified);
 
 protected:
   boost::logic::tribool m_outcome{boost::logic::indeterminate};
@@ -188,8 +194,11 @@ public:
   }
 
 private:
+  std::function<bool(const std::optional<Certificate>&)>
+  getOriginalPacketVerifier() const final;
+
   void
-  verifyOriginalPacket(const std::optional<Certificate>& trustedCert) final;
+  finishValidation(bool isSignatureValid) final;
 
   void
   bypassValidation() final;
@@ -240,8 +249,11 @@ public:
   signal::Signal<InterestValidationState, Interest> afterSuccess;
 
 private:
+  std::function<bool(const std::optional<Certificate>&)>
+  getOriginalPacketVerifier() const final;
+
   void
-  verifyOriginalPacket(const std::optional<Certificate>& trustedCert) final;
+  finishValidation(bool isSignatureValid) final;
 
   void
   bypassValidation() final;
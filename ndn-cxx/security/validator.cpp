@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,8 +20,13 @@
  */
 
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/lexical_cast.hpp>
 
 namespace ndn::security {
@@ -31,6 +36,28 @@ NDN_LOG_INIT(ndn.security.Validator);
 #define NDN_LOG_DEBUG_DEPTH(x) NDN_LOG_DEBUG(std::string(state->getDepth() + 1, '>') << " " << x)
 #define NDN_LOG_TRACE_DEPTH(x) NDN_LOG_TRACE(std::string(state->getDepth() + 1, '>') << " " << x)
 
+class Validator::AsyncVerifier : ndn::noncopyable
+{
+public:
+  AsyncVerifier(boost::asio::io_context& ioCtx, size_t nThreads)
+    : ioCtx(ioCtx)
+    , pool(nThreads)
+  {
+  }
+
+  ~AsyncVerifier()
+  {
+    // abandon the verifications that have not started, so that the calling thread (usually
+    // the one running ioCtx) only waits for those that are currently running
+    pool.stop();
+    pool.join();
+  }
+
+public:
+  boost::asio::io_context& ioCtx;
+  boost::asio::thread_pool pool;
+};
+
 Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<CertificateFetcher> certFetcher)
   : m_policy(std::move(policy))
   , m_certFetcher(std::move(certFetcher))
@@ -43,6 +70,19 @@ Validator::Validator(unique_ptr<ValidationPolicy> policy, unique_ptr<Certificate
 
 Validator::~Validator() noexcept = default;
 
+void
+Validator::enableAsyncVerification(boost::asio::io_context& ioCtx, size_t nThreads)
+{
+  BOOST_ASSERT(nThreads > 0);
+  m_asyncVerifier = make_shared<AsyncVerifier>(ioCtx, nThreads);
+}
+
+void
+Validator::disableAsyncVerification()
+{
+  m_asyncVerifier.reset();
+}
+
 void
 Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
@@ -127,7 +167,7 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   }
 
   if (certRequest->interest.getName() == SigningInfo::getDigestSha256Identity()) {
-    state->verifyOriginalPacket(std::nullopt);
+    verifySignatures(std::nullopt, state);
     return;
   }
 
@@ -141,16 +181,7 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   auto cert = findTrustedCert(certRequest->interest);
   if (cert != nullptr) {
     NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
-
-    cert = state->verifyCertificateChain(*cert);
-    if (cert != nullptr) {
-      state->verifyOriginalPacket(*cert);
-    }
-    for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
-         trustedCert != std::make_move_iterator(state->m_certificateChain.end());
-         ++trustedCert) {
-      cacheVerifiedCertificate(*trustedCert);
-    }
+    verifySignatures(*cert, state);
     return;
   }
 
@@ -159,6 +190,68 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   });
 }
 
+void
+Validator::verifySignatures(const std::optional<Certificate>& trustedCert,
+                            const shared_ptr<ValidationState>& state)
+{
+  // The verification works on copies of the certificates and of the original packet, so that
+  // it does not share any object with the state when it runs on a worker thread.
+  std::vector<Certificate> chain;
+  if (trustedCert) {
+    chain.assign(state->m_certificateChain.begin(), state->m_certificateChain.end());
+  }
+  auto verify = [trustedCert, chain = std::move(chain),
+                 verifyPacket = state->getOriginalPacketVerifier()] {
+    const Certificate* signer = trustedCert ? &*trustedCert : nullptr;
+    size_t nVerified = 0;
+    for (const auto& cert : chain) {
+      if (!verifySignature(cert, *signer)) {
+        return std::pair(nVerified, false);
+      }
+      signer = &cert;
+      ++nVerified;
+    }
+    return std::pair(nVerified, verifyPacket(signer ? std::optional(*signer) : std::nullopt));
+  };
+
+  if (m_asyncVerifier == nullptr) {
+    auto [nVerified, isPacketValid] = verify();
+    finishVerification(nVerified, isPacketValid, state);
+    return;
+  }
+
+  // the work guard keeps the io_context running until the result is applied
+  auto& ioCtx = m_asyncVerifier->ioCtx;
+  boost::asio::post(m_asyncVerifier->pool,
+    [this, &ioCtx, weakVerifier = weak_ptr<AsyncVerifier>(m_asyncVerifier), state,
+     verify = std::move(verify), work = boost::asio::make_work_guard(ioCtx)] () mutable {
+      // runs on a worker thread, must not access the validator or the state
+      auto result = verify();
+      boost::asio::post(ioCtx, [this, weakVerifier = std::move(weakVerifier), state = std::move(state),
+                                result] {
+        // the verifier is gone if the validator has been destroyed or the mode has changed
+        if (!weakVerifier.expired()) {
+          finishVerification(result.first, result.second, state);
+        }
+      });
+      work.reset();
+    });
+}
+
+void
+Validator::finishVerification(size_t nVerifiedCerts, bool isPacketValid,
+                              const shared_ptr<ValidationState>& state)
+{
+  if (state->applyCertificateChainResult(nVerifiedCerts)) {
+    state->finishValidation(isPacketValid);
+  }
+  for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
+       trustedCert != std::make_move_iterator(state->m_certificateChain.end());
+       ++trustedCert) {
+    cacheVerifiedCertificate(*trustedCert);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////
 // Trust anchor management
 ////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -22,6 +22,7 @@
 #ifndef NDN_CXX_SECURITY_VALIDATOR_HPP
 #define NDN_CXX_SECURITY_VALIDATOR_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/security/certificate-fetcher.hpp"
 #include "ndn-cxx/security/certificate-request.hpp"
 #include "ndn-cxx/security/certificate-storage.hpp"
@@ -100,6 +101,32 @@ public:
     m_maxDepth = depth;
   }
 
+  /**
+   * @brief Verify signatures on a pool of worker threads.
+   *
+   * Only the cryptographic verification of the certificate chain and of the validated packet
+   * is moved to the worker threads.  Policy checks, certificate retrieval, and the invocation
+   * of the validation callbacks remain on the thread that runs @p ioCtx, which must also be
+   * the thread that calls validate().  The callbacks are always invoked from @p ioCtx after
+   * validate() has returned, and the validations of different packets may complete in a
+   * different order than they were started.
+   *
+   * @param ioCtx    The io_context of the application, typically Face::getIoContext().
+   * @param nThreads Number of worker threads, must be positive.
+   * @note Changing the verification mode, or destroying the validator, abandons the verifications
+   *       that are in progress, whose failure callbacks are invoked with IMPLEMENTATION_ERROR
+   *       error code, either immediately or from @p ioCtx. This only waits for the worker threads
+   *       to finish the verifications they have already started.
+   */
+  void
+  enableAsyncVerification(boost::asio::io_context& ioCtx, size_t nThreads);
+
+  /**
+   * @brief Verify signatures synchronously on the calling thread (the default).
+   */
+  void
+  disableAsyncVerification();
+
   /**
    * @brief Asynchronously validate @p data.
    *
@@ -197,10 +224,32 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Verify the signatures of the certificate chain and of the original packet.
+   *
+   * @param trustedCert  The certificate that signs the first certificate of the chain, or the
+   *                     original packet if the chain is empty; nullopt if the original packet
+   *                     does not need a certificate for verification.
+   * @param state        The current validation state.
+   */
+  void
+  verifySignatures(const std::optional<Certificate>& trustedCert,
+                   const shared_ptr<ValidationState>& state);
+
+  /**
+   * @brief Apply the outcome of verifySignatures() to @p state.
+   */
+  void
+  finishVerification(size_t nVerifiedCerts, bool isPacketValid,
+                     const shared_ptr<ValidationState>& state);
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth{25};
+
+  class AsyncVerifier;
+  shared_ptr<AsyncVerifier> m_asyncVerifier; ///< nullptr if signatures are verified synchronously
 };
 
 } // namespace security
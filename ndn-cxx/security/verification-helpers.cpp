@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -25,6 +25,9 @@
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/security/certificate.hpp"
+#include "ndn-cxx/security/impl/batch-verifier.hpp"
+#include "ndn-cxx/security/impl/public-key-cache.hpp"
+#include "ndn-cxx/security/merkle-tree.hpp"
 #include "ndn-cxx/security/pib/key.hpp"
 #include "ndn-cxx/security/tpm/tpm.hpp"
 #include "ndn-cxx/security/transform/bool-sink.hpp"
@@ -34,6 +37,8 @@
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/verifier-filter.hpp"
 
+#include <map>
+
 #include <openssl/crypto.h>
 
 namespace ndn::security {
@@ -56,6 +61,7 @@ public:
   SignatureInfo info;
   InputBuffers bufs;
   span<const uint8_t> sig;
+  ConstBufferPtr signedInput; ///< owns the bytes in @c bufs, if they are not part of the packet
 };
 
 } // namespace
@@ -79,23 +85,46 @@ verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transf
 bool
 verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, span<const uint8_t> key)
 {
-  transform::PublicKey pKey;
-  try {
-    pKey.loadPkcs8(key);
-  }
-  catch (const transform::Error&) {
-    return false;
+  // parsing the key is a sizeable fraction of the verification cost, so parsed keys are reused
+  auto pKey = detail::PublicKeyCache::getInstance().get(key);
+  return pKey != nullptr && verifySignature(blobs, sig, *pKey);
+}
+
+/**
+ * @brief Replace the signed portion of a Data packet signed by KeyChain::signBatch() with
+ *        the input of the batch signature.
+ */
+static void
+resolveMerkleSignature(ParseResult& params, const Block& auditPathWire)
+{
+  MerkleAuditPath auditPath(auditPathWire);
+  BOOST_ASSERT(params.bufs.size() == 1);
+  auto root = auditPath.computeRoot(MerkleTree::computeDataLeaf(params.bufs.front()));
+  if (!root) {
+    params.bufs.clear();
+    return;
   }
 
-  return verifySignature(blobs, sig, pKey);
+  SignatureInfo sigInfo = params.info;
+  sigInfo.removeCustomTlv(tlv::security::MerkleAuditPath);
+  const Block& sigInfoWire = sigInfo.wireEncode();
+
+  auto signedInput = make_shared<Buffer>(sigInfoWire.begin(), sigInfoWire.end());
+  signedInput->insert(signedInput->end(), root->begin(), root->end());
+  params.bufs = {*signedInput};
+  params.signedInput = std::move(signedInput);
 }
 
 static ParseResult
 parse(const Data& data)
 {
   try {
-    return {data.getSignatureInfo(), data.extractSignedRanges(),
-            data.getSignatureValue().value_bytes()};
+    ParseResult result(data.getSignatureInfo(), data.extractSignedRanges(),
+                       data.getSignatureValue().value_bytes());
+    if (auto auditPath = result.info.getCustomTlv(tlv::security::MerkleAuditPath); auditPath) {
+      resolveMerkleSignature(result, *auditPath);
+    }
+    return result;
   }
   catch (const tlv::Error&) {
     return {};
@@ -202,6 +231,98 @@ verifySignature(const Interest& interest, const transform::PublicKey& key)
   return verifySignature(parse(interest), key);
 }
 
+namespace {
+
+/**
+ * @brief Verifies the signatures of many parsed packets.
+ *
+ * One OpenSSL context is reused for all packets, and a batch signature produced by
+ * KeyChain::signBatch() is verified only once per key.
+ */
+class PacketVerifier : noncopyable
+{
+public:
+  bool
+  verify(const ParseResult& parsed, const transform::PublicKey& key)
+  {
+    if (parsed.bufs.empty()) {
+      return false;
+    }
+    if (parsed.signedInput == nullptr) {
+      return m_verifier.verify(parsed.bufs, parsed.sig, key);
+    }
+
+    auto isSameBatch = [&] (const VerifiedBatch& batch) {
+      return batch.key == &key && *batch.signedInput == *parsed.signedInput &&
+             std::equal(batch.sig.begin(), batch.sig.end(), parsed.sig.begin(), parsed.sig.end());
+    };
+    // packets of a batch are usually adjacent, so the most recent batch is checked first
+    if (std::any_of(m_verified.rbegin(), m_verified.rend(), isSameBatch)) {
+      return true;
+    }
+    if (!m_verifier.verify(parsed.bufs, parsed.sig, key)) {
+      return false;
+    }
+    m_verified.push_back({&key, parsed.signedInput, parsed.sig});
+    return true;
+  }
+
+private:
+  struct VerifiedBatch
+  {
+    const transform::PublicKey* key;
+    ConstBufferPtr signedInput;
+    span<const uint8_t> sig;
+  };
+
+  detail::BatchVerifier m_verifier;
+  std::vector<VerifiedBatch> m_verified;
+};
+
+} // namespace
+
+bool
+verifySignatures(span<const Data> packets, const transform::PublicKey& key)
+{
+  PacketVerifier verifier;
+  return std::all_of(packets.begin(), packets.end(),
+                     [&] (const Data& data) { return verifier.verify(parse(data), key); });
+}
+
+template<typename Packet>
+static std::vector<bool>
+verifySignaturesImpl(span<const Packet> packets, span<const span<const uint8_t>> keys)
+{
+  if (packets.size() != keys.size()) {
+    NDN_THROW(std::invalid_argument("Number of packets and number of keys differ"));
+  }
+
+  PacketVerifier verifier;
+  // packets that refer to the same key bits are grouped, so that each key is looked up once
+  std::map<std::pair<const uint8_t*, size_t>, shared_ptr<const transform::PublicKey>> parsedKeys;
+  std::vector<bool> results(packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    auto [it, isNew] = parsedKeys.try_emplace({keys[i].data(), keys[i].size()});
+    if (isNew) {
+      it->second = detail::PublicKeyCache::getInstance().get(keys[i]);
+    }
+    results[i] = it->second != nullptr && verifier.verify(parse(packets[i]), *it->second);
+  }
+  return results;
+}
+
+std::vector<bool>
+verifySignatures(span<const Data> packets, span<const span<const uint8_t>> keys)
+{
+  return verifySignaturesImpl(packets, keys);
+}
+
+std::vector<bool>
+verifySignatures(span<const Interest> packets, span<const span<const uint8_t>> keys)
+{
+  return verifySignaturesImpl(packets, keys);
+}
+
 bool
 verifySignature(const Data& data, const pib::Key& key)
 {
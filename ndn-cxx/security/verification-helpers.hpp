@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -87,6 +87,42 @@ verifySignature(const Data& data, const transform::PublicKey& key);
 [[nodiscard]] bool
 verifySignature(const Interest& interest, const transform::PublicKey& key);
 
+/**
+ * @brief Verify all packets in @p packets using @p key.
+ *
+ * Packets that were signed together by KeyChain::signBatch() are verified with a single
+ * public key operation.
+ *
+ * @return true if the signatures of all packets are valid
+ */
+[[nodiscard]] bool
+verifySignatures(span<const Data> packets, const transform::PublicKey& key);
+
+/**
+ * @brief Verify the signatures of many Data packets, each with its own public key.
+ *
+ * Each distinct key is parsed once and one OpenSSL context is reused for all packets, which
+ * makes this function considerably faster than calling verifySignature() for each packet.
+ * Packets that were signed together by KeyChain::signBatch() are verified with a single
+ * public key operation.
+ *
+ * @param packets The packets to verify.
+ * @param keys    Public keys in PKCS #8 format, `keys[i]` is used to verify `packets[i]`.
+ * @return For each packet, whether its signature is valid.
+ * @throw std::invalid_argument @p packets and @p keys have different sizes.
+ */
+[[nodiscard]] std::vector<bool>
+verifySignatures(span<const Data> packets, span<const span<const uint8_t>> keys);
+
+/**
+ * @brief Verify the signatures of many Interest packets, each with its own public key.
+ *
+ * @sa verifySignatures(span<const Data>, span<const span<const uint8_t>>)
+ * @note This method verifies only signatures of the signed interests.
+ */
+[[nodiscard]] std::vector<bool>
+verifySignatures(span<const Interest> packets, span<const span<const uint8_t>> keys);
+
 /**
  * @brief Verify @p data using @p key.
  */
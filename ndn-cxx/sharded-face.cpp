@@ -0,0 +1,492 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/sharded-face.hpp"
+#include "ndn-cxx/lp/fields.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "ndn-cxx/lp/pit-token.hpp"
+#include "ndn-cxx/transport/transport.hpp"
+#include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/scope.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include <mutex>
+#include <optional>
+#include <thread>
+
+NDN_LOG_INIT(ndn.ShardedFace);
+
+namespace ndn {
+namespace {
+
+/**
+ * @brief PIT token that identifies the shard that has expressed an Interest.
+ *
+ * The token consists of two magic octets followed by the shard index in network byte order.
+ */
+class ShardToken
+{
+public:
+  static lp::PitToken
+  encode(size_t shardIndex)
+  {
+    const Buffer token{MAGIC[0], MAGIC[1],
+                       static_cast<uint8_t>(shardIndex >> 8), static_cast<uint8_t>(shardIndex)};
+    return lp::PitToken(std::pair(token.begin(), token.end()));
+  }
+
+  /**
+   * @return the shard index, or std::nullopt if the token was not created by encode()
+   */
+  static std::optional<size_t>
+  decode(const std::pair<Buffer::const_iterator, Buffer::const_iterator>& token)
+  {
+    if (std::distance(token.first, token.second) != 4 ||
+        token.first[0] != MAGIC[0] || token.first[1] != MAGIC[1]) {
+      return std::nullopt;
+    }
+    return (static_cast<size_t>(token.first[2]) << 8) | token.first[3];
+  }
+
+private:
+  static constexpr uint8_t MAGIC[] = {0x5F, 0xD5};
+};
+
+} // namespace
+
+class ShardedFace::Impl : noncopyable
+{
+private:
+  /**
+   * @brief Transport of a shard's Face, which exchanges packets with the I/O thread.
+   */
+  class ShardTransport final : public Transport
+  {
+  public:
+    ShardTransport(Impl& owner, size_t shardIndex)
+      : m_owner(owner)
+      , m_shardIndex(shardIndex)
+    {
+    }
+
+    void
+    connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback) final
+    {
+      Transport::connect(ioCtx, std::move(receiveCallback));
+      setState(State::RUNNING);
+    }
+
+    void
+    close() final
+    {
+      setState(State::CLOSED);
+    }
+
+    void
+    pause() final
+    {
+      // Interests steered to this shard must be delivered even if the shard's PIT is empty
+    }
+
+    void
+    resume() final
+    {
+    }
+
+    /**
+     * @brief Queue a packet for the I/O thread (called on the shard's thread).
+     */
+    void
+    send(const Block& wire) final
+    {
+      m_outbox.push_back(wire);
+      if (m_outbox.size() == 1) {
+        // packets sent in the meantime by the same handler or by subsequent ready handlers
+        // will be handed off to the I/O thread together
+        boost::asio::post(*m_ioCtx, [this] {
+          m_owner.sendFromShard(m_shardIndex, std::exchange(m_outbox, {}));
+        });
+      }
+    }
+
+    /**
+     * @brief Deliver a batch of packets received by the I/O thread (called on the shard's thread).
+     */
+    void
+    receive(const std::vector<Block>& batch) const
+    {
+      for (const auto& wire : batch) {
+        if (m_receiveCallback) {
+          m_receiveCallback(wire);
+        }
+      }
+    }
+
+  private:
+    Impl& m_owner;
+    const size_t m_shardIndex;
+    std::vector<Block> m_outbox;
+  };
+
+  /**
+   * @brief Transport of the I/O Face, which wraps the transport to the forwarder.
+   */
+  class IoTransport final : public Transport
+  {
+  public:
+    IoTransport(Impl& owner, shared_ptr<Transport> transport)
+      : m_owner(owner)
+      , m_transport(std::move(transport))
+    {
+    }
+
+    void
+    connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback) final
+    {
+      Transport::connect(ioCtx, std::move(receiveCallback));
+      m_transport->connect(ioCtx, [this] (const Block& wire) { m_owner.onReceiveElement(wire); });
+      // the I/O Face connects without resuming, but the shards must receive Interests from the start
+      m_transport->resume();
+      setState(State::RUNNING);
+    }
+
+    void
+    close() final
+    {
+      m_transport->close();
+      setState(State::CLOSED);
+    }
+
+    void
+    pause() final
+    {
+      // the I/O Face may have nothing pending, but the shards still need the transport
+    }
+
+    void
+    resume() final
+    {
+      m_transport->resume();
+    }
+
+    void
+    send(const Block& wire) final
+    {
+      m_transport->send(wire);
+    }
+
+    void
+    deliver(const Block& wire) const
+    {
+      if (m_receiveCallback) {
+        m_receiveCallback(wire);
+      }
+    }
+
+  private:
+    Impl& m_owner;
+    shared_ptr<Transport> m_transport;
+  };
+
+  struct Shard
+  {
+    boost::asio::io_context ioCtx;
+    shared_ptr<ShardTransport> transport;
+    unique_ptr<Face> face;
+    std::thread thread;
+    std::vector<Block> inbox; ///< packets waiting for hand-off, owned by the I/O thread
+  };
+
+public:
+  Impl(shared_ptr<Transport> transport, KeyChain& keyChain, size_t nShards)
+    : m_ioTransport(make_shared<IoTransport>(*this, std::move(transport)))
+    , m_ioFace(m_ioTransport, m_ioCtx, keyChain)
+  {
+    BOOST_ASSERT(nShards > 0 && nShards <= 0x10000);
+    for (size_t i = 0; i < nShards; ++i) {
+      auto& shard = *m_shards.emplace_back(make_unique<Shard>());
+      shard.transport = make_shared<ShardTransport>(*this, i);
+      shard.face = make_unique<Face>(shard.transport, shard.ioCtx, keyChain);
+    }
+  }
+
+  ~Impl()
+  {
+    stopShards();
+  }
+
+  size_t
+  getShardIndex(const Name& name) const
+  {
+    return std::hash<Name>{}(name) % m_shards.size();
+  }
+
+  void
+  run()
+  {
+    m_ioCtx.restart();
+    auto stopOnExit = make_scope_exit([this] { stopShards(); });
+
+    for (auto& shardPtr : m_shards) {
+      auto& shard = *shardPtr;
+      shard.ioCtx.restart();
+      shard.thread = std::thread([this, &shard] {
+        try {
+          auto work = boost::asio::make_work_guard(shard.ioCtx);
+          shard.ioCtx.run();
+        }
+        catch (...) {
+          std::lock_guard lock(m_errorMutex);
+          if (!m_error) {
+            m_error = std::current_exception();
+          }
+          m_ioCtx.stop();
+        }
+      });
+    }
+
+    {
+      auto work = boost::asio::make_work_guard(m_ioCtx);
+      m_ioCtx.run();
+    }
+
+    stopShards();
+    std::lock_guard lock(m_errorMutex);
+    if (m_error) {
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+  }
+
+  void
+  shutdown()
+  {
+    m_ioCtx.stop();
+    for (auto& shard : m_shards) {
+      shard->ioCtx.stop();
+    }
+  }
+
+private:
+  void
+  stopShards()
+  {
+    for (auto& shard : m_shards) {
+      shard->ioCtx.stop();
+    }
+    for (auto& shard : m_shards) {
+      if (shard->thread.joinable()) {
+        shard->thread.join();
+      }
+    }
+  }
+
+  /**
+   * @brief Steer a packet received from the forwarder (called on the I/O thread).
+   */
+  void
+  onReceiveElement(const Block& wire)
+  {
+    lp::Packet lpPacket;
+    Block netPacket = wire;
+    if (wire.type() != tlv::Interest && wire.type() != tlv::Data) {
+      lpPacket.wireDecode(wire);
+      if (!lpPacket.has<lp::FragmentField>()) {
+        m_ioTransport->deliver(wire);
+        return;
+      }
+      auto frag = lpPacket.get<lp::FragmentField>();
+      netPacket = Block(wire, frag.first, frag.second);
+    }
+
+    if (netPacket.type() == tlv::Interest && !lpPacket.has<lp::NackField>()) {
+      // decode only the name, the rest of the Interest is decoded by the shard
+      netPacket.parse();
+      deliverToShard(getShardIndex(Name(netPacket.get(tlv::Name))), wire);
+      return;
+    }
+
+    if (lpPacket.has<lp::PitTokenField>()) {
+      auto shardIndex = ShardToken::decode(lpPacket.get<lp::PitTokenField>());
+      if (shardIndex && *shardIndex < m_shards.size()) {
+        deliverToShard(*shardIndex, wire);
+        return;
+      }
+    }
+
+    // Data or Nack not addressed to a shard: it could belong to any pending Interest
+    m_ioTransport->deliver(wire);
+    for (size_t i = 0; i < m_shards.size(); ++i) {
+      deliverToShard(i, wire);
+    }
+  }
+
+  void
+  deliverToShard(size_t shardIndex, const Block& wire)
+  {
+    m_shards[shardIndex]->inbox.push_back(wire);
+    if (m_isHandOffScheduled) {
+      return;
+    }
+
+    // Hand off all packets received in this round of the I/O loop at once. Each hand-off is
+    // a post() to the shard's io_context, which locks the io_context's mutex; batching makes
+    // this cost per round instead of per packet, and keeps the wake-up of an idle shard
+    // thread, which a lock-free queue would also need, on the same code path.
+    m_isHandOffScheduled = true;
+    boost::asio::post(m_ioCtx, [this] {
+      m_isHandOffScheduled = false;
+      for (auto& shard : m_shards) {
+        if (shard->inbox.empty()) {
+          continue;
+        }
+        boost::asio::post(shard->ioCtx, [transport = shard->transport,
+                                         batch = std::exchange(shard->inbox, {})] {
+          transport->receive(batch);
+        });
+      }
+    });
+  }
+
+  /**
+   * @brief Send a batch of packets from a shard to the forwarder.
+   *
+   * This is called on the shard's thread, and hands off the batch to the I/O thread.
+   */
+  void
+  sendFromShard(size_t shardIndex, std::vector<Block> batch)
+  {
+    boost::asio::post(m_ioCtx, [this, shardIndex, batch = std::move(batch)] {
+      for (const auto& wire : batch) {
+        m_ioTransport->send(addShardToken(wire, shardIndex));
+      }
+    });
+  }
+
+  /**
+   * @brief Tag an Interest with the token of the shard that has expressed it.
+   * @return @p wire unchanged if it is not an Interest
+   */
+  static Block
+  addShardToken(const Block& wire, size_t shardIndex)
+  {
+    lp::Packet lpPacket;
+    if (wire.type() == tlv::Interest) {
+      lpPacket.add<lp::FragmentField>({wire.begin(), wire.end()});
+    }
+    else if (wire.type() == lp::tlv::LpPacket) {
+      lpPacket.wireDecode(wire);
+      if (!lpPacket.has<lp::FragmentField>() || lpPacket.has<lp::NackField>()) {
+        return wire;
+      }
+      auto frag = lpPacket.get<lp::FragmentField>();
+      if (*frag.first != tlv::Interest) {
+        return wire;
+      }
+    }
+    else {
+      return wire;
+    }
+
+    lpPacket.set<lp::PitTokenField>(ShardToken::encode(shardIndex));
+    return lpPacket.wireEncode();
+  }
+
+private:
+  boost::asio::io_context m_ioCtx;
+  shared_ptr<IoTransport> m_ioTransport;
+  Face m_ioFace;
+  std::vector<unique_ptr<Shard>> m_shards;
+  bool m_isHandOffScheduled = false;
+
+  std::mutex m_errorMutex;
+  std::exception_ptr m_error;
+
+  friend ShardedFace;
+};
+
+ShardedFace::ShardedFace(shared_ptr<Transport> transport, KeyChain& keyChain, size_t nShards)
+  : m_impl(make_unique<Impl>(std::move(transport), keyChain, nShards))
+{
+}
+
+ShardedFace::~ShardedFace() = default;
+
+size_t
+ShardedFace::getNShards() const noexcept
+{
+  return m_impl->m_shards.size();
+}
+
+Face&
+ShardedFace::getShard(size_t index)
+{
+  return *m_impl->m_shards.at(index)->face;
+}
+
+Face&
+ShardedFace::getIoFace() noexcept
+{
+  return m_impl->m_ioFace;
+}
+
+size_t
+ShardedFace::getShardIndex(const Name& name) const
+{
+  return m_impl->getShardIndex(name);
+}
+
+void
+ShardedFace::setInterestFilter(const InterestFilter& filter, const ShardInterestCallback& onInterest)
+{
+  for (auto& shard : m_impl->m_shards) {
+    shard->face->setInterestFilter(filter, [&face = *shard->face, onInterest] (const auto& f, const auto& i) {
+      onInterest(face, f, i);
+    });
+  }
+}
+
+RegisteredPrefixHandle
+ShardedFace::setInterestFilter(const InterestFilter& filter, const ShardInterestCallback& onInterest,
+                               const RegisterPrefixSuccessCallback& onSuccess,
+                               const RegisterPrefixFailureCallback& onFailure,
+                               const security::SigningInfo& signingInfo, uint64_t flags)
+{
+  setInterestFilter(filter, onInterest);
+  return m_impl->m_ioFace.registerPrefix(filter.getPrefix(), onSuccess, onFailure, signingInfo, flags);
+}
+
+void
+ShardedFace::run()
+{
+  NDN_LOG_DEBUG("run nShards=" << m_impl->m_shards.size());
+  m_impl->run();
+}
+
+void
+ShardedFace::shutdown()
+{
+  m_impl->shutdown();
+}
+
+} // namespace ndn
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SHARDED_FACE_HPP
+#define NDN_CXX_SHARDED_FACE_HPP
+
+#include "ndn-cxx/face.hpp"
+
+namespace ndn {
+
+/**
+ * @brief Callback invoked on a shard's thread when an incoming Interest matches an InterestFilter
+ *
+ * The first argument is the Face of the shard that the Interest has been steered to. Replies
+ * must be sent through that Face, from within the callback or later on the same thread.
+ */
+using ShardInterestCallback = std::function<void(Face&, const InterestFilter&, const Interest&)>;
+
+/**
+ * @brief A Face whose packet processing is spread across several threads.
+ *
+ * A ShardedFace owns one transport to the forwarder, which is serviced by an I/O thread, and
+ * a number of shards. Each shard is an ordinary Face, with its own pending Interest table,
+ * InterestFilter table, and Scheduler, bound to its own io_context that is run by a dedicated
+ * worker thread. Shards do not share any state with each other.
+ *
+ * Incoming Interests are steered to shards by a hash of their name (see getShardIndex()), so
+ * that Interests with the same name are always processed by the same shard. Interests expressed
+ * by a shard are tagged with a PIT token identifying that shard; Data and Nacks that carry such
+ * a token are delivered only to that shard, whereas those without a token (e.g., because the
+ * forwarder does not support PIT tokens) are delivered to every shard. All packets sent by the
+ * shards are funneled back to the I/O thread and written to the transport.
+ *
+ * Packets are passed between threads in batches: each hand-off between the I/O thread and a
+ * shard carries every packet that has accumulated since the previous hand-off, instead of
+ * one packet at a time, so that synchronization is not incurred per packet.
+ *
+ * InterestFilters must be set before run() is called. The Face of a shard must only be used
+ * from that shard's thread; in particular, it must not be used to register prefixes, which
+ * is the role of getIoFace().
+ */
+class ShardedFace : noncopyable
+{
+public:
+  /**
+   * @brief Create a ShardedFace.
+   * @param transport the transport to the forwarder, must not be nullptr
+   * @param keyChain KeyChain used to sign prefix registration commands
+   * @param nShards number of shards, typically the number of available cores
+   */
+  ShardedFace(shared_ptr<Transport> transport, KeyChain& keyChain, size_t nShards);
+
+  ~ShardedFace();
+
+  size_t
+  getNShards() const noexcept;
+
+  /**
+   * @brief Return the Face of a shard.
+   * @pre @p index < getNShards()
+   */
+  Face&
+  getShard(size_t index);
+
+  /**
+   * @brief Return the Face that is bound to the I/O thread.
+   *
+   * This Face receives the Data and Nacks that are not addressed to a shard, and can be used
+   * for prefix registration and other management operations.
+   */
+  Face&
+  getIoFace() noexcept;
+
+  /**
+   * @brief Return the index of the shard that processes incoming Interests with @p name.
+   */
+  size_t
+  getShardIndex(const Name& name) const;
+
+  /**
+   * @brief Set an InterestFilter on every shard, without registering the prefix.
+   */
+  void
+  setInterestFilter(const InterestFilter& filter, const ShardInterestCallback& onInterest);
+
+  /**
+   * @brief Set an InterestFilter on every shard, and register its prefix through getIoFace().
+   * @return A handle for unregistering the prefix.
+   */
+  RegisteredPrefixHandle
+  setInterestFilter(const InterestFilter& filter, const ShardInterestCallback& onInterest,
+                    const RegisterPrefixSuccessCallback& onSuccess,
+                    const RegisterPrefixFailureCallback& onFailure,
+                    const security::SigningInfo& signingInfo = security::SigningInfo(),
+                    uint64_t flags = nfd::ROUTE_FLAG_CHILD_INHERIT);
+
+  /**
+   * @brief Start the shard threads, and run the I/O loop on the calling thread.
+   *
+   * This function returns after shutdown() is called, or rethrows the first exception
+   * raised on any of the threads.
+   */
+  void
+  run();
+
+  /**
+   * @brief Stop all threads.
+   * @note This function is thread-safe.
+   */
+  void
+  shutdown();
+
+private:
+  class Impl;
+  unique_ptr<Impl> m_impl;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_SHARDED_FACE_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -63,6 +63,12 @@ SignatureInfo::wireEncode(EncodingImpl<TAG>& encoder, SignatureInfo::Type type)
   //                           [SignatureSeqNum]
   //                           *OtherSubelements
 
+  if (m_wire.hasWire() && m_wire.type() == to_underlying(type)) {
+    // reuse the cached encoding, which saves walking the elements in both the estimation
+    // and the encoding pass of the enclosing packet
+    return prependBlock(encoder, m_wire);
+  }
+
   size_t totalLength = 0;
 
   // m_otherTlvs contains (if set) SignatureNonce, SignatureTime, SignatureSeqNum, ValidityPeriod,
@@ -93,7 +99,7 @@ SignatureInfo::wireEncode<encoding::EstimatorTag>(EncodingEstimator&, SignatureI
 const Block&
 SignatureInfo::wireEncode(SignatureInfo::Type type) const
 {
-  if (m_wire.hasWire())
+  if (m_wire.hasWire() && m_wire.type() == to_underlying(type))
     return m_wire;
 
   EncodingEstimator estimator;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -75,6 +75,8 @@ public:
    *  Elements are encoded in the following order: `SignatureType`, `%KeyLocator` (if present), and
    *  other elements in the order they were set (changing the value of an already present element
    *  will not change that element's encoding order).
+   *
+   *  If this instance has a cached wire encoding of the requested @p type, it is prepended as is.
    */
   template<encoding::Tag TAG>
   size_t
@@ -0,0 +1,255 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/transport/detail/shm-channel.hpp"
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+namespace ndn::detail {
+
+/**
+ * \brief Control block at the beginning of each ring.
+ *
+ * Positions are monotonically increasing byte counters; the offset into the ring data is
+ * the position modulo the ring capacity. The producer owns \p writePos and the consumer
+ * owns \p readPos, each on its own cache line.
+ */
+struct ShmChannel::RingHeader
+{
+  alignas(64) std::atomic<uint64_t> writePos{0};
+  alignas(64) std::atomic<uint64_t> readPos{0};
+  /// set by the producer when the ring is full, cleared by the consumer when it notifies
+  alignas(64) std::atomic<uint32_t> isProducerBlocked{0};
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "atomics in shared memory must be lock-free");
+
+constexpr size_t RING_HEADER_SIZE = 192;
+
+[[noreturn]] static void
+throwErrno(const char* what)
+{
+  NDN_THROW(std::system_error(errno, std::system_category(), what));
+}
+
+ShmChannel::ShmChannel(size_t ringCapacity)
+  : m_role(Role::CLIENT)
+  , m_ringCapacity(ringCapacity)
+{
+  BOOST_ASSERT(ringCapacity >= MAX_NDN_PACKET_SIZE);
+
+  m_memFd = ::memfd_create("ndn-cxx-shm-channel", MFD_CLOEXEC);
+  if (m_memFd < 0) {
+    throwErrno("memfd_create");
+  }
+  m_clientEventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  m_forwarderEventFd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (m_clientEventFd < 0 || m_forwarderEventFd < 0) {
+    int err = errno;
+    release();
+    errno = err;
+    throwErrno("eventfd");
+  }
+
+  if (::ftruncate(m_memFd, 2 * (RING_HEADER_SIZE + m_ringCapacity)) != 0) {
+    int err = errno;
+    release();
+    errno = err;
+    throwErrno("ftruncate");
+  }
+  map();
+
+  for (size_t i = 0; i < 2; ++i) {
+    new (&getRingHeader(i)) RingHeader;
+  }
+}
+
+ShmChannel::ShmChannel(Role role, int memFd, int clientEventFd, int forwarderEventFd,
+                       size_t ringCapacity)
+  : m_role(role)
+  , m_memFd(memFd)
+  , m_clientEventFd(clientEventFd)
+  , m_forwarderEventFd(forwarderEventFd)
+  , m_ringCapacity(ringCapacity)
+{
+  map();
+}
+
+ShmChannel::~ShmChannel()
+{
+  release();
+}
+
+void
+ShmChannel::release() noexcept
+{
+  if (m_region != nullptr) {
+    ::munmap(m_region, m_regionSize);
+    m_region = nullptr;
+  }
+  for (int* fd : {&m_memFd, &m_clientEventFd, &m_forwarderEventFd}) {
+    if (*fd >= 0) {
+      ::close(*fd);
+      *fd = -1;
+    }
+  }
+}
+
+void
+ShmChannel::map()
+{
+  static_assert(sizeof(RingHeader) <= RING_HEADER_SIZE);
+
+  // ring 0 carries elements from the client to the forwarder, ring 1 in the other direction
+  m_txRing = m_role == Role::CLIENT ? 0 : 1;
+  m_rxRing = 1 - m_txRing;
+
+  m_regionSize = 2 * (RING_HEADER_SIZE + m_ringCapacity);
+  void* region = ::mmap(nullptr, m_regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_memFd, 0);
+  if (region == MAP_FAILED) {
+    int err = errno;
+    release();
+    errno = err;
+    throwErrno("mmap");
+  }
+  m_region = static_cast<uint8_t*>(region);
+}
+
+ShmChannel::RingHeader&
+ShmChannel::getRingHeader(size_t ringIndex) const
+{
+  return *reinterpret_cast<RingHeader*>(m_region + ringIndex * (RING_HEADER_SIZE + m_ringCapacity));
+}
+
+uint8_t*
+ShmChannel::getRingData(size_t ringIndex) const
+{
+  return m_region + ringIndex * (RING_HEADER_SIZE + m_ringCapacity) + RING_HEADER_SIZE;
+}
+
+void
+ShmChannel::copyFromRing(size_t ringIndex, uint64_t pos, span<uint8_t> out) const
+{
+  const uint8_t* data = getRingData(ringIndex);
+  size_t offset = pos % m_ringCapacity;
+  size_t firstPart = std::min(out.size(), m_ringCapacity - offset);
+  std::memcpy(out.data(), data + offset, firstPart);
+  std::memcpy(out.data() + firstPart, data, out.size() - firstPart);
+}
+
+bool
+ShmChannel::write(span<const uint8_t> element)
+{
+  BOOST_ASSERT(element.size() <= m_ringCapacity);
+  auto& header = getRingHeader(m_txRing);
+  uint64_t writePos = header.writePos.load(std::memory_order_relaxed);
+  uint64_t readPos = header.readPos.load(std::memory_order_acquire);
+
+  if (m_ringCapacity - (writePos - readPos) < element.size()) {
+    // announce that we are blocked, then check again in case the consumer has just caught up
+    header.isProducerBlocked.store(1);
+    readPos = header.readPos.load();
+    if (m_ringCapacity - (writePos - readPos) < element.size()) {
+      return false;
+    }
+    header.isProducerBlocked.store(0);
+  }
+
+  uint8_t* data = getRingData(m_txRing);
+  size_t offset = writePos % m_ringCapacity;
+  size_t firstPart = std::min(element.size(), m_ringCapacity - offset);
+  std::memcpy(data + offset, element.data(), firstPart);
+  std::memcpy(data, element.data() + firstPart, element.size() - firstPart);
+
+  header.writePos.store(writePos + element.size(), std::memory_order_release);
+  return true;
+}
+
+std::tuple<bool, Block>
+ShmChannel::read()
+{
+  auto& header = getRingHeader(m_rxRing);
+  uint64_t readPos = header.readPos.load(std::memory_order_relaxed);
+  uint64_t writePos = header.writePos.load(std::memory_order_acquire);
+  uint64_t available = writePos - readPos;
+  if (available == 0) {
+    return {false, {}};
+  }
+
+  // TLV-TYPE and TLV-LENGTH occupy at most 5 + 9 octets
+  std::array<uint8_t, 14> tl;
+  auto tlBytes = make_span(tl).first(std::min<uint64_t>(available, tl.size()));
+  copyFromRing(m_rxRing, readPos, tlBytes);
+
+  auto pos = tlBytes.begin();
+  uint32_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readType(pos, tlBytes.end(), type) || !tlv::readVarNumber(pos, tlBytes.end(), length)) {
+    if (tlBytes.size() == tl.size()) {
+      NDN_THROW(tlv::Error("Malformed TLV element in shared memory ring"));
+    }
+    return {false, {}};
+  }
+
+  uint64_t tlSize = static_cast<uint64_t>(std::distance(tlBytes.begin(), pos));
+  if (length > MAX_NDN_PACKET_SIZE || tlSize + length > MAX_NDN_PACKET_SIZE) {
+    NDN_THROW(tlv::Error("TLV element in shared memory ring exceeds MAX_NDN_PACKET_SIZE"));
+  }
+  if (tlSize + length > available) {
+    return {false, {}};
+  }
+
+  auto buffer = std::make_shared<Buffer>(tlSize + length);
+  copyFromRing(m_rxRing, readPos, *buffer);
+  header.readPos.store(readPos + buffer->size());
+
+  return {true, Block(std::move(buffer))};
+}
+
+void
+ShmChannel::wakeBlockedPeer()
+{
+  auto& header = getRingHeader(m_rxRing);
+  if (header.isProducerBlocked.load() != 0 && header.isProducerBlocked.exchange(0) != 0) {
+    notifyPeer();
+  }
+}
+
+void
+ShmChannel::notifyPeer()
+{
+  int peerEventFd = m_role == Role::CLIENT ? m_forwarderEventFd : m_clientEventFd;
+  uint64_t one = 1;
+  // EAGAIN means the counter is about to overflow, so the peer has pending notifications anyway
+  while (::write(peerEventFd, &one, sizeof(one)) < 0 && errno == EINTR)
+    ;
+}
+
+} // namespace ndn::detail
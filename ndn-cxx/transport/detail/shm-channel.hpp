@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TRANSPORT_DETAIL_SHM_CHANNEL_HPP
+#define NDN_CXX_TRANSPORT_DETAIL_SHM_CHANNEL_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+#ifndef NDN_CXX_HAVE_MEMFD
+#error "This file must not be included when memfd support is disabled"
+#endif
+
+namespace ndn::detail {
+
+/**
+ * \brief One end of a bidirectional channel of TLV elements over shared memory.
+ *
+ * The channel consists of two single-producer single-consumer byte rings, one in each
+ * direction, placed in a single memfd-backed shared memory region, and two eventfds that
+ * serve as "doorbells": each end waits on its own eventfd and increments the eventfd of
+ * the other end after it has written into the other end's incoming ring, or after it has
+ * freed up space in a ring on which the other end is blocked.
+ *
+ * The client end creates the shared memory region and the eventfds; the forwarder end
+ * attaches to them using file descriptors received from the client (see ShmTransport).
+ */
+class ShmChannel : noncopyable
+{
+public:
+  enum class Role {
+    CLIENT,
+    FORWARDER,
+  };
+
+  /**
+   * \brief Default capacity of each ring, in octets.
+   */
+  static constexpr size_t DEFAULT_RING_CAPACITY = 1 << 20;
+
+  /**
+   * \brief Create a new channel as the client end.
+   * \param ringCapacity capacity of each ring, must be at least MAX_NDN_PACKET_SIZE
+   * \throw std::system_error shared memory region or eventfds cannot be created
+   */
+  explicit
+  ShmChannel(size_t ringCapacity = DEFAULT_RING_CAPACITY);
+
+  /**
+   * \brief Attach to an existing channel.
+   * \param role which end of the channel to attach as
+   * \param memFd file descriptor of the shared memory region
+   * \param clientEventFd file descriptor of the client's eventfd
+   * \param forwarderEventFd file descriptor of the forwarder's eventfd
+   * \param ringCapacity capacity of each ring
+   * \throw std::system_error shared memory region cannot be mapped
+   * \note The channel takes ownership of all file descriptors.
+   */
+  ShmChannel(Role role, int memFd, int clientEventFd, int forwarderEventFd, size_t ringCapacity);
+
+  ~ShmChannel();
+
+  int
+  getMemFd() const noexcept
+  {
+    return m_memFd;
+  }
+
+  int
+  getClientEventFd() const noexcept
+  {
+    return m_clientEventFd;
+  }
+
+  int
+  getForwarderEventFd() const noexcept
+  {
+    return m_forwarderEventFd;
+  }
+
+  /**
+   * \brief Return the eventfd on which this end waits for notifications.
+   */
+  int
+  getOwnEventFd() const noexcept
+  {
+    return m_role == Role::CLIENT ? m_clientEventFd : m_forwarderEventFd;
+  }
+
+  size_t
+  getRingCapacity() const noexcept
+  {
+    return m_ringCapacity;
+  }
+
+  /**
+   * \brief Append a TLV element to the outgoing ring.
+   * \return whether the element was written; false if the ring does not have enough space,
+   *         in which case the other end will notify this end once it has consumed from the ring
+   * \note The other end is not notified; call notifyPeer() after writing a batch of elements.
+   */
+  bool
+  write(span<const uint8_t> element);
+
+  /**
+   * \brief Remove the next TLV element from the incoming ring.
+   * \return `true` and the element, which is copied out of shared memory, if a complete element
+   *         is available; otherwise `false` and an invalid Block
+   * \throw tlv::Error the incoming ring contains an element larger than MAX_NDN_PACKET_SIZE
+   */
+  std::tuple<bool, Block>
+  read();
+
+  /**
+   * \brief Notify the other end if it is blocked on writing into the incoming ring.
+   *
+   * This should be called after a batch of elements has been read.
+   */
+  void
+  wakeBlockedPeer();
+
+  /**
+   * \brief Increment the eventfd of the other end.
+   */
+  void
+  notifyPeer();
+
+private:
+  struct RingHeader;
+
+  RingHeader&
+  getRingHeader(size_t ringIndex) const;
+
+  uint8_t*
+  getRingData(size_t ringIndex) const;
+
+  void
+  copyFromRing(size_t ringIndex, uint64_t pos, span<uint8_t> out) const;
+
+  void
+  map();
+
+  void
+  release() noexcept;
+
+private:
+  Role m_role;
+  int m_memFd = -1;
+  int m_clientEventFd = -1;
+  int m_forwarderEventFd = -1;
+  size_t m_ringCapacity;
+  size_t m_regionSize = 0;
+  uint8_t* m_region = nullptr;
+  size_t m_txRing; ///< index of the ring written by this end
+  size_t m_rxRing; ///< index of the ring read by this end
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_TRANSPORT_DETAIL_SHM_CHANNEL_HPP
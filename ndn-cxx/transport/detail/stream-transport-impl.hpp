@@ -28,9 +28,7 @@
 #include <boost/asio/write.hpp>
 #include <boost/lexical_cast.hpp>
 
-#include <array>
-#include <list>
-#include <queue>
+#include <deque>
 
 namespace ndn::detail {
 
@@ -44,7 +42,15 @@ template<typename BaseTransport, typename Protocol>
 class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportImpl<BaseTransport, Protocol>>
 {
 protected:
-  using TransmissionQueue = std::queue<Block, std::list<Block>>;
+  using TransmissionQueue = std::deque<Block>;
+
+  /**
+   * \brief Size of each receive buffer in zero-copy mode.
+   *
+   * Every receive buffer holds at least one complete TLV element of maximum size, so that a
+   * new buffer is needed at most once per MAX_NDN_PACKET_SIZE bytes of received elements.
+   */
+  static constexpr size_t ZERO_COPY_RX_BUFFER_SIZE = 4 * MAX_NDN_PACKET_SIZE;
 
 public:
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_context& ioCtx)
@@ -93,6 +99,7 @@ public:
     m_socket.close(error);
 
     TransmissionQueue{}.swap(m_transmissionQueue); // clear the queue
+    m_nBlocksInFlight = 0;
   }
 
   void
@@ -109,7 +116,7 @@ public:
   {
     if (m_transport.getState() == Transport::State::PAUSED) {
       m_transport.setState(Transport::State::RUNNING);
-      m_rxBufferSize = 0;
+      m_rxBegin = m_rxEnd = 0;
       asyncReceive();
     }
   }
@@ -117,7 +124,7 @@ public:
   void
   send(const Block& block)
   {
-    m_transmissionQueue.push(block);
+    m_transmissionQueue.push_back(block);
 
     if (m_transport.getState() != Transport::State::CLOSED &&
         m_transport.getState() != Transport::State::CONNECTING &&
@@ -125,7 +132,8 @@ public:
       asyncWrite();
     }
     // if not connected or there's another transmission in progress (m_transmissionQueue.size() > 1),
-    // the next write will be scheduled either in connectHandler or in asyncWriteHandler
+    // the next write will be scheduled either in connectHandler or in asyncWriteHandler, and
+    // will include this block together with all other blocks queued in the meantime
   }
 
 protected:
@@ -152,11 +160,31 @@ protected:
     }
   }
 
+  /**
+   * \brief Write all queued blocks to the socket with a single gathering write.
+   *
+   * If a maximum write batch size is set on the transport, the batch is cut short before the
+   * first block that would exceed it, but always contains at least one block.
+   */
   void
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, boost::asio::buffer(m_transmissionQueue.front()),
+    BOOST_ASSERT(m_nBlocksInFlight == 0);
+
+    const size_t maxBatchSize = m_transport.getMaxWriteBatchSize();
+    size_t batchSize = 0;
+    m_txBuffers.clear();
+    for (const auto& block : m_transmissionQueue) {
+      if (maxBatchSize > 0 && !m_txBuffers.empty() && batchSize + block.size() > maxBatchSize) {
+        break;
+      }
+      m_txBuffers.emplace_back(block.data(), block.size());
+      batchSize += block.size();
+    }
+    m_nBlocksInFlight = m_txBuffers.size();
+
+    boost::asio::async_write(m_socket, m_txBuffers,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
       [this, self = this->shared_from_this()] (const auto& error, size_t) {
         if (error) {
@@ -172,8 +200,10 @@ protected:
           return; // queue has already been cleared
         }
 
-        BOOST_ASSERT(!m_transmissionQueue.empty());
-        m_transmissionQueue.pop();
+        BOOST_ASSERT(m_transmissionQueue.size() >= m_nBlocksInFlight);
+        m_transmissionQueue.erase(m_transmissionQueue.begin(),
+                                  m_transmissionQueue.begin() + m_nBlocksInFlight);
+        m_nBlocksInFlight = 0;
 
         if (!m_transmissionQueue.empty()) {
           asyncWrite();
@@ -184,8 +214,9 @@ protected:
   void
   asyncReceive()
   {
-    m_socket.async_receive(boost::asio::buffer(m_rxBuffer.data() + m_rxBufferSize,
-                                               m_rxBuffer.size() - m_rxBufferSize),
+    prepareReceiveBuffer();
+    m_socket.async_receive(boost::asio::buffer(m_rxBuffer->data() + m_rxEnd,
+                                               m_rxBuffer->size() - m_rxEnd),
       // capture a copy of the shared_ptr to "this" to prevent deallocation
       [this, self = this->shared_from_this()] (const auto& error, size_t nBytesRecvd) {
         if (error) {
@@ -197,27 +228,17 @@ protected:
           NDN_THROW(Transport::Error(error, "socket read error"));
         }
 
-        m_rxBufferSize += nBytesRecvd;
-        auto unparsedBytes = make_span(m_rxBuffer).first(m_rxBufferSize);
-        while (!unparsedBytes.empty()) {
-          auto [isOk, element] = Block::fromBuffer(unparsedBytes);
+        m_rxEnd += nBytesRecvd;
+        while (m_rxBegin < m_rxEnd) {
+          auto [isOk, element] = parseReceivedElement();
           if (!isOk) {
             break;
           }
-          unparsedBytes = unparsedBytes.subspan(element.size());
+          m_rxBegin += element.size();
           m_transport.m_receiveCallback(element);
         }
 
-        if (unparsedBytes.empty()) {
-          // nothing left in the receive buffer
-          m_rxBufferSize = 0;
-        }
-        else if (unparsedBytes.data() != m_rxBuffer.data()) {
-          // move remaining unparsed bytes to the beginning of the receive buffer
-          std::copy(unparsedBytes.begin(), unparsedBytes.end(), m_rxBuffer.begin());
-          m_rxBufferSize = unparsedBytes.size();
-        }
-        else if (unparsedBytes.size() == m_rxBuffer.size()) {
+        if (m_rxEnd - m_rxBegin >= MAX_NDN_PACKET_SIZE) {
           m_transport.close();
           NDN_THROW(Transport::Error("receive buffer full, but a valid TLV cannot be decoded"));
         }
@@ -226,14 +247,84 @@ protected:
       });
   }
 
+  /**
+   * \brief Ensure the receive buffer has room for a complete TLV element after the unparsed bytes.
+   */
+  void
+  prepareReceiveBuffer()
+  {
+    const bool wantZeroCopy = m_transport.isZeroCopyReceiveEnabled();
+    const size_t bufferSize = wantZeroCopy ? ZERO_COPY_RX_BUFFER_SIZE : MAX_NDN_PACKET_SIZE;
+    if (m_rxBuffer != nullptr && m_rxBuffer->size() == bufferSize &&
+        m_rxBuffer->size() - m_rxBegin >= MAX_NDN_PACKET_SIZE) {
+      return;
+    }
+
+    span<const uint8_t> unparsedBytes;
+    if (m_rxBuffer != nullptr) {
+      unparsedBytes = make_span(*m_rxBuffer).subspan(m_rxBegin, m_rxEnd - m_rxBegin);
+    }
+
+    if (m_rxBuffer == nullptr || m_rxBuffer->size() != bufferSize || m_rxBuffer.use_count() > 1) {
+      // previously received elements may still refer to the current buffer, so start a new one
+      auto newBuffer = std::make_shared<Buffer>(bufferSize);
+      std::copy(unparsedBytes.begin(), unparsedBytes.end(), newBuffer->begin());
+      m_rxBuffer = std::move(newBuffer);
+    }
+    else {
+      // move remaining unparsed bytes to the beginning of the receive buffer
+      std::copy(unparsedBytes.begin(), unparsedBytes.end(), m_rxBuffer->begin());
+    }
+    m_rxBegin = 0;
+    m_rxEnd = unparsedBytes.size();
+  }
+
+  /**
+   * \brief Try to parse a TLV element at the beginning of the unparsed bytes.
+   *
+   * In zero-copy mode, the returned Block shares the receive buffer; otherwise, the TLV element
+   * is copied into a new buffer, and the receive buffer can be reused right away.
+   */
+  std::tuple<bool, Block>
+  parseReceivedElement() const
+  {
+    auto unparsedBytes = make_span(*m_rxBuffer).subspan(m_rxBegin, m_rxEnd - m_rxBegin);
+    if (!m_transport.isZeroCopyReceiveEnabled()) {
+      return Block::fromBuffer(unparsedBytes);
+    }
+
+    auto pos = unparsedBytes.begin();
+    const auto end = unparsedBytes.end();
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!tlv::readType(pos, end, type) || !tlv::readVarNumber(pos, end, length) ||
+        length > static_cast<uint64_t>(std::distance(pos, end))) {
+      return {false, {}};
+    }
+    // pos now points to TLV-VALUE
+    auto tlSize = std::distance(unparsedBytes.begin(), pos);
+    if (tlSize + length > MAX_NDN_PACKET_SIZE) {
+      // same limit as in non-zero-copy mode, where the receive buffer cannot hold a larger element
+      return {false, {}};
+    }
+
+    auto begin = std::next(m_rxBuffer->cbegin(), m_rxBegin);
+    auto valueBegin = std::next(begin, tlSize);
+    auto valueEnd = std::next(valueBegin, length);
+    return {true, Block(m_rxBuffer, type, begin, valueEnd, valueBegin, valueEnd)};
+  }
+
 protected:
   BaseTransport& m_transport;
   typename Protocol::endpoint m_endpoint;
   typename Protocol::socket m_socket;
   boost::asio::steady_timer m_connectTimer;
   TransmissionQueue m_transmissionQueue;
-  size_t m_rxBufferSize = 0;
-  std::array<uint8_t, MAX_NDN_PACKET_SIZE> m_rxBuffer;
+  std::vector<boost::asio::const_buffer> m_txBuffers; ///< buffer sequence of the write in progress
+  size_t m_nBlocksInFlight = 0; ///< number of blocks at the front of the queue being written
+  shared_ptr<Buffer> m_rxBuffer;
+  size_t m_rxBegin = 0; ///< offset of the first unparsed byte in m_rxBuffer
+  size_t m_rxEnd = 0; ///< offset past the last received byte in m_rxBuffer
 };
 
 } // namespace ndn::detail
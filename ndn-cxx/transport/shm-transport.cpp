@@ -0,0 +1,409 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/transport/shm-transport.hpp"
+#include "ndn-cxx/transport/detail/shm-channel.hpp"
+
+#include "ndn-cxx/net/face-uri.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/post.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <deque>
+
+NDN_LOG_INIT(ndn.ShmTransport);
+// DEBUG level: connect, close, pause, resume.
+
+namespace ndn {
+
+/// Magic octets at the beginning of the handshake message; the last octet is the version.
+const uint8_t SHM_HANDSHAKE_MAGIC[8] = {'N', 'D', 'N', 'S', 'H', 'M', 0x00, 0x01};
+
+class ShmTransport::Impl : public std::enable_shared_from_this<ShmTransport::Impl>
+{
+public:
+  Impl(ShmTransport& transport, boost::asio::io_context& ioCtx)
+    : m_transport(transport)
+    , m_socket(ioCtx)
+    , m_eventFd(ioCtx)
+  {
+  }
+
+  void
+  connect(const std::string& path)
+  {
+    if (m_transport.getState() == Transport::State::CONNECTING) {
+      return;
+    }
+
+    m_transport.setState(Transport::State::CONNECTING);
+    m_socket.async_connect(boost::asio::local::stream_protocol::endpoint(path),
+                           [self = shared_from_this(), path] (const auto& error) {
+      self->connectHandler(error, path);
+    });
+  }
+
+  void
+  close()
+  {
+    m_transport.setState(Transport::State::CLOSED);
+
+    boost::system::error_code error; // to silently ignore all errors
+    m_socket.cancel(error);
+    m_socket.close(error);
+    m_eventFd.cancel(error);
+    m_eventFd.close(error);
+
+    m_channel.reset();
+    std::deque<Block>{}.swap(m_transmissionQueue); // clear the queue
+  }
+
+  void
+  pause()
+  {
+    // the eventfd is still being waited on, because the forwarder also uses it to signal that
+    // there is space in the outgoing ring; received elements are left in the incoming ring
+    if (m_transport.getState() == Transport::State::RUNNING) {
+      m_transport.setState(Transport::State::PAUSED);
+    }
+  }
+
+  void
+  resume()
+  {
+    if (m_transport.getState() == Transport::State::PAUSED) {
+      m_transport.setState(Transport::State::RUNNING);
+      // elements may have arrived while paused, for which no further notification will come
+      boost::asio::post(m_eventFd.get_executor(), [self = shared_from_this()] {
+        self->processRings();
+      });
+    }
+  }
+
+  void
+  send(const Block& block)
+  {
+    m_transmissionQueue.push_back(block);
+
+    if (m_channel != nullptr && m_transmissionQueue.size() == 1) {
+      flushTransmissionQueue();
+    }
+    // otherwise, the queue will be flushed after the handshake, or when the forwarder
+    // notifies that it has consumed from the (currently full) outgoing ring
+  }
+
+private:
+  void
+  connectHandler(const boost::system::error_code& error, const std::string& path)
+  {
+    if (error) {
+      if (error == boost::asio::error::operation_aborted) {
+        // async_connect was explicitly cancelled (e.g., socket close)
+        return;
+      }
+      m_transport.close();
+      NDN_THROW(Transport::Error(error, "could not connect to NDN forwarder at " + path));
+    }
+
+    try {
+      m_channel = make_unique<detail::ShmChannel>();
+      sendHandshake();
+
+      int eventFd = ::dup(m_channel->getOwnEventFd());
+      if (eventFd < 0) {
+        NDN_THROW(std::system_error(errno, std::system_category(), "dup"));
+      }
+      m_eventFd.assign(eventFd);
+    }
+    catch (const std::system_error& e) {
+      m_transport.close();
+      NDN_THROW_NESTED(Transport::Error("shared memory handshake with NDN forwarder at " +
+                                        path + " failed: " + e.what()));
+    }
+
+    m_transport.setState(Transport::State::PAUSED);
+    asyncWaitForDisconnect();
+    asyncWaitForEvent();
+
+    if (!m_transmissionQueue.empty()) {
+      resume();
+      flushTransmissionQueue();
+    }
+  }
+
+  /**
+   * \brief Pass the shared memory region and the eventfds to the forwarder.
+   */
+  void
+  sendHandshake()
+  {
+    uint8_t payload[sizeof(SHM_HANDSHAKE_MAGIC) + sizeof(uint64_t)];
+    uint64_t ringCapacity = m_channel->getRingCapacity();
+    std::memcpy(payload, SHM_HANDSHAKE_MAGIC, sizeof(SHM_HANDSHAKE_MAGIC));
+    std::memcpy(payload + sizeof(SHM_HANDSHAKE_MAGIC), &ringCapacity, sizeof(ringCapacity));
+
+    const int fds[] = {m_channel->getMemFd(), m_channel->getClientEventFd(),
+                       m_channel->getForwarderEventFd()};
+    alignas(cmsghdr) uint8_t control[CMSG_SPACE(sizeof(fds))] = {};
+
+    iovec iov{payload, sizeof(payload)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    ssize_t nSent = 0;
+    do {
+      nSent = ::sendmsg(m_socket.native_handle(), &msg, MSG_NOSIGNAL);
+    } while (nSent < 0 && errno == EINTR);
+    if (nSent < 0) {
+      NDN_THROW(std::system_error(errno, std::system_category(), "sendmsg"));
+    }
+    if (static_cast<size_t>(nSent) != sizeof(payload)) {
+      NDN_THROW(std::system_error(std::make_error_code(std::errc::message_size), "sendmsg"));
+    }
+  }
+
+  /**
+   * \brief Detect that the forwarder has closed the rendezvous socket.
+   */
+  void
+  asyncWaitForDisconnect()
+  {
+    m_socket.async_wait(boost::asio::socket_base::wait_read,
+      [this, self = shared_from_this()] (const auto& error) {
+        if (error == boost::asio::error::operation_aborted) {
+          return;
+        }
+
+        boost::system::error_code readError = error;
+        if (!readError) {
+          // the forwarder is not expected to send anything after the handshake
+          uint8_t discard[64];
+          m_socket.receive(boost::asio::buffer(discard), 0, readError);
+          if (!readError) {
+            asyncWaitForDisconnect();
+            return;
+          }
+        }
+        m_transport.close();
+        NDN_THROW(Transport::Error(readError, "connection to NDN forwarder closed"));
+      });
+  }
+
+  void
+  asyncWaitForEvent()
+  {
+    m_eventFd.async_read_some(boost::asio::buffer(&m_eventCount, sizeof(m_eventCount)),
+      // capture a copy of the shared_ptr to "this" to prevent deallocation
+      [this, self = shared_from_this()] (const auto& error, size_t) {
+        if (error) {
+          if (error == boost::asio::error::operation_aborted) {
+            // async_read_some was explicitly cancelled (e.g., close)
+            return;
+          }
+          m_transport.close();
+          NDN_THROW(Transport::Error(error, "eventfd read error"));
+        }
+
+        processRings();
+        if (m_channel != nullptr) {
+          asyncWaitForEvent();
+        }
+      });
+  }
+
+  /**
+   * \brief Deliver received elements if running, and resume writing into the outgoing ring.
+   */
+  void
+  processRings()
+  {
+    if (m_channel == nullptr) {
+      return;
+    }
+
+    bool hasRead = false;
+    while (m_transport.getState() == Transport::State::RUNNING) {
+      bool isOk = false;
+      Block element;
+      try {
+        std::tie(isOk, element) = m_channel->read();
+      }
+      catch (const tlv::Error&) {
+        m_transport.close();
+        NDN_THROW_NESTED(Transport::Error("shared memory ring contains an invalid TLV element"));
+      }
+      if (!isOk) {
+        break;
+      }
+      hasRead = true;
+      m_transport.m_receiveCallback(element);
+      if (m_channel == nullptr) {
+        return; // transport closed by the callback
+      }
+    }
+
+    if (hasRead) {
+      m_channel->wakeBlockedPeer();
+    }
+    if (!m_transmissionQueue.empty()) {
+      flushTransmissionQueue();
+    }
+  }
+
+  /**
+   * \brief Write queued blocks into the outgoing ring, for as long as there is space.
+   *
+   * The forwarder is notified once per batch of sends, from a handler posted to the io_context.
+   */
+  void
+  flushTransmissionQueue()
+  {
+    BOOST_ASSERT(m_channel != nullptr);
+
+    bool hasWritten = false;
+    while (!m_transmissionQueue.empty()) {
+      const Block& block = m_transmissionQueue.front();
+      if (!m_channel->write({block.data(), block.size()})) {
+        break; // the forwarder will notify us after it has consumed from the ring
+      }
+      m_transmissionQueue.pop_front();
+      hasWritten = true;
+    }
+
+    if (hasWritten && !m_hasPendingNotify) {
+      m_hasPendingNotify = true;
+      boost::asio::post(m_eventFd.get_executor(), [this, self = shared_from_this()] {
+        m_hasPendingNotify = false;
+        if (m_channel != nullptr) {
+          m_channel->notifyPeer();
+        }
+      });
+    }
+  }
+
+private:
+  ShmTransport& m_transport;
+  boost::asio::local::stream_protocol::socket m_socket; ///< rendezvous socket
+  boost::asio::posix::stream_descriptor m_eventFd; ///< duplicate of this end's eventfd
+  unique_ptr<detail::ShmChannel> m_channel;
+  std::deque<Block> m_transmissionQueue;
+  uint64_t m_eventCount = 0;
+  bool m_hasPendingNotify = false;
+};
+
+ShmTransport::ShmTransport(const std::string& rendezvousSocket)
+  : m_rendezvousSocket(rendezvousSocket)
+{
+}
+
+ShmTransport::~ShmTransport() = default;
+
+std::string
+ShmTransport::getSocketNameFromUri(const std::string& uriString)
+{
+  // Use path from the provided URI, if valid.
+  if (!uriString.empty()) {
+    try {
+      const FaceUri uri(uriString);
+      if (uri.getScheme() != "shm") {
+        NDN_THROW(Error("Cannot create ShmTransport from \"" + uri.getScheme() + "\" URI"));
+      }
+      if (!uri.getPath().empty()) {
+        return uri.getPath();
+      }
+    }
+    catch (const FaceUri::Error& error) {
+      NDN_THROW_NESTED(Error(error.what()));
+    }
+  }
+
+  // Otherwise, use the default location.
+  return "/run/nfd/nfd-shm.sock";
+}
+
+shared_ptr<ShmTransport>
+ShmTransport::create(const std::string& uri)
+{
+  return make_shared<ShmTransport>(getSocketNameFromUri(uri));
+}
+
+void
+ShmTransport::connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback)
+{
+  NDN_LOG_DEBUG("connect path=" << m_rendezvousSocket);
+
+  if (m_impl == nullptr) {
+    Transport::connect(ioCtx, std::move(receiveCallback));
+    m_impl = make_shared<Impl>(*this, ioCtx);
+  }
+
+  m_impl->connect(m_rendezvousSocket);
+}
+
+void
+ShmTransport::send(const Block& wire)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(wire);
+}
+
+void
+ShmTransport::close()
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  NDN_LOG_DEBUG("close");
+  m_impl->close();
+  m_impl.reset();
+}
+
+void
+ShmTransport::pause()
+{
+  if (m_impl != nullptr) {
+    NDN_LOG_DEBUG("pause");
+    m_impl->pause();
+  }
+}
+
+void
+ShmTransport::resume()
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  NDN_LOG_DEBUG("resume");
+  m_impl->resume();
+}
+
+} // namespace ndn
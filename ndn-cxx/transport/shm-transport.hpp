@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TRANSPORT_SHM_TRANSPORT_HPP
+#define NDN_CXX_TRANSPORT_SHM_TRANSPORT_HPP
+
+#include "ndn-cxx/transport/transport.hpp"
+
+#ifndef NDN_CXX_HAVE_MEMFD
+#error "This file must not be included when memfd support is disabled"
+#endif
+
+namespace ndn {
+
+/**
+ * \brief A transport that exchanges TLV elements with a co-located forwarder through
+ *        shared memory.
+ *
+ * Upon connect(), the transport connects to a Unix stream socket of the forwarder (the
+ * "rendezvous" socket), creates a memfd-backed shared memory region holding a pair of
+ * single-producer single-consumer rings plus two eventfds, and passes these three file
+ * descriptors to the forwarder in one message over the rendezvous socket:
+ *
+ *  - message payload: 8 octets of magic "NDNSHM\0\1", followed by the capacity of each
+ *    ring as a 64-bit unsigned integer in host byte order;
+ *  - ancillary data (SCM_RIGHTS): memfd, client eventfd, forwarder eventfd.
+ *
+ * Afterwards, TLV elements are exchanged only through the rings, and the rendezvous
+ * socket is used solely to detect that the other end has gone away. Sending a burst of
+ * elements costs one eventfd write, instead of one socket write per element.
+ *
+ * This transport is available on Linux only.
+ */
+class ShmTransport : public Transport
+{
+public:
+  explicit
+  ShmTransport(const std::string& rendezvousSocket);
+
+  ~ShmTransport() override;
+
+  void
+  connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback) override;
+
+  void
+  close() override;
+
+  void
+  pause() override;
+
+  void
+  resume() override;
+
+  void
+  send(const Block& wire) override;
+
+  /**
+   * \brief Create transport with parameters defined in URI.
+   * \throw Transport::Error incorrect URI or unsupported protocol is specified
+   */
+  static shared_ptr<ShmTransport>
+  create(const std::string& uri);
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static std::string
+  getSocketNameFromUri(const std::string& uri);
+
+private:
+  class Impl;
+
+  std::string m_rendezvousSocket;
+  shared_ptr<Impl> m_impl;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_TRANSPORT_SHM_TRANSPORT_HPP
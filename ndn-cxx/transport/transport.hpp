@@ -105,6 +105,58 @@ public:
     return m_state;
   }
 
+  /**
+   * \brief Return whether zero-copy receive is enabled.
+   */
+  bool
+  isZeroCopyReceiveEnabled() const noexcept
+  {
+    return m_wantZeroCopyReceive;
+  }
+
+  /**
+   * \brief Enable or disable zero-copy receive.
+   *
+   * By default, each received TLV element is copied into its own buffer before being passed
+   * to the receive callback. When zero-copy receive is enabled, the transport instead reads
+   * into refcounted receive buffers, and every Block passed to the receive callback (as well
+   * as any packet decoded from it) shares ownership of the receive buffer it was read into.
+   * This saves one allocation and one copy per packet, but a receive buffer, which is a few
+   * times larger than MAX_NDN_PACKET_SIZE, stays in memory as long as any packet read into
+   * it is retained by the application.
+   *
+   * \note Transports that do not have a receive buffer ignore this setting.
+   */
+  void
+  setZeroCopyReceive(bool wantZeroCopy) noexcept
+  {
+    m_wantZeroCopyReceive = wantZeroCopy;
+  }
+
+  /**
+   * \brief Return the maximum number of octets written in one batch, or 0 if unlimited.
+   */
+  size_t
+  getMaxWriteBatchSize() const noexcept
+  {
+    return m_maxWriteBatchSize;
+  }
+
+  /**
+   * \brief Limit the number of octets written in one batch.
+   *
+   * Stream-oriented transports coalesce all TLV blocks queued for transmission into a single
+   * gathering write. This setting caps the total size of such a batch; a batch always contains
+   * at least one block, even if that block alone exceeds the limit.
+   *
+   * \param nOctets maximum batch size in octets, or 0 for no limit (the default)
+   */
+  void
+  setMaxWriteBatchSize(size_t nOctets) noexcept
+  {
+    m_maxWriteBatchSize = nOctets;
+  }
+
 protected:
   void
   setState(State state) noexcept
@@ -118,6 +170,8 @@ protected:
 
 private:
   State m_state = State::CLOSED;
+  bool m_wantZeroCopyReceive = false;
+  size_t m_maxWriteBatchSize = 0;
 };
 
 } // namespace ndn
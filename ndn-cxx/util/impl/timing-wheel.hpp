@@ -0,0 +1,292 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_IMPL_TIMING_WHEEL_HPP
+#define NDN_CXX_UTIL_IMPL_TIMING_WHEEL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <array>
+#include <optional>
+
+namespace ndn::detail {
+
+/**
+ * \brief Hook that makes an object insertable into a TimingWheel.
+ */
+struct TimingWheelHook
+{
+  static constexpr uint16_t NOT_LINKED = 0xFFFF;
+
+  TimingWheelHook* wheelPrev = nullptr;
+  TimingWheelHook* wheelNext = nullptr;
+  uint64_t wheelTick = 0; ///< tick at which the object expires
+  uint16_t wheelSlot = NOT_LINKED; ///< index of the list that contains the object
+};
+
+/**
+ * \brief Hierarchical timing wheel of intrusively linked objects.
+ *
+ * Time is measured in ticks of arbitrary duration. Each of the N_LEVELS levels has N_SLOTS
+ * slots; a slot at level `l` spans `N_SLOTS^l` ticks. An object is placed at the lowest level
+ * whose slot can tell it apart from the current tick, and is moved down ("cascaded") when the
+ * current tick reaches the beginning of its slot. Objects that are too far in the future are
+ * kept in an overflow list that is cascaded once per full rotation of the top level.
+ *
+ * Insertion and removal are O(1). Finding the next tick that requires attention is O(N_LEVELS),
+ * using a bitmap of non-empty slots per level.
+ */
+class TimingWheel : noncopyable
+{
+public:
+  static constexpr unsigned SLOT_BITS = 6;
+  static constexpr size_t N_SLOTS = 1 << SLOT_BITS;
+  static constexpr size_t N_LEVELS = 6;
+  static constexpr uint16_t OVERFLOW_LIST = N_LEVELS * N_SLOTS;
+  static constexpr uint16_t DUE_LIST = OVERFLOW_LIST + 1;
+  static constexpr uint16_t NOT_LINKED = TimingWheelHook::NOT_LINKED;
+
+  ~TimingWheel()
+  {
+    BOOST_ASSERT(empty());
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  uint64_t
+  getCurrentTick() const noexcept
+  {
+    return m_currentTick;
+  }
+
+  /**
+   * \brief Move the current tick, which is only allowed while the wheel is empty.
+   */
+  void
+  setCurrentTick(uint64_t tick) noexcept
+  {
+    BOOST_ASSERT(empty());
+    m_currentTick = tick;
+  }
+
+  /**
+   * \brief Insert an object that expires at `hook.wheelTick`.
+   *
+   * If that tick is not later than the current tick, the object is due immediately.
+   */
+  void
+  insert(TimingWheelHook& hook) noexcept
+  {
+    BOOST_ASSERT(hook.wheelSlot == NOT_LINKED);
+    place(hook);
+    ++m_size;
+  }
+
+  void
+  erase(TimingWheelHook& hook) noexcept
+  {
+    BOOST_ASSERT(hook.wheelSlot <= DUE_LIST);
+    unlink(hook);
+    --m_size;
+  }
+
+  /**
+   * \brief Return the earliest tick at which advance() has any work to do.
+   * \retval std::nullopt the wheel is empty
+   */
+  std::optional<uint64_t>
+  getNextTick() const noexcept
+  {
+    if (m_lists[DUE_LIST] != nullptr) {
+      return m_currentTick;
+    }
+
+    std::optional<uint64_t> next;
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+      if (m_bitmaps[level] == 0) {
+        continue;
+      }
+      // all non-empty slots of a level are after the current slot of that level
+      uint64_t slot = static_cast<uint64_t>(__builtin_ctzll(m_bitmaps[level]));
+      unsigned shift = level * SLOT_BITS;
+      uint64_t tick = ((m_currentTick >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) | (slot << shift);
+      if (!next || tick < *next) {
+        next = tick;
+      }
+    }
+    if (m_lists[OVERFLOW_LIST] != nullptr) {
+      constexpr unsigned shift = N_LEVELS * SLOT_BITS;
+      uint64_t tick = ((m_currentTick >> shift) + 1) << shift;
+      if (!next || tick < *next) {
+        next = tick;
+      }
+    }
+    return next;
+  }
+
+  /**
+   * \brief Advance the current tick to \p target, and remove all objects that expire by then.
+   * \param f function invoked with each removed object, in no particular order
+   */
+  template<typename F>
+  void
+  advance(uint64_t target, const F& f)
+  {
+    while (true) {
+      while (m_lists[DUE_LIST] != nullptr) {
+        TimingWheelHook& hook = *m_lists[DUE_LIST];
+        erase(hook);
+        f(hook);
+      }
+
+      auto next = getNextTick();
+      if (!next || *next > target) {
+        m_currentTick = std::max(m_currentTick, target);
+        return;
+      }
+      m_currentTick = *next;
+      cascade();
+    }
+  }
+
+  /**
+   * \brief Remove all objects.
+   * \param f function invoked with each removed object
+   */
+  template<typename F>
+  void
+  clear(const F& f)
+  {
+    for (auto& list : m_lists) {
+      while (list != nullptr) {
+        TimingWheelHook& hook = *list;
+        erase(hook);
+        f(hook);
+      }
+    }
+  }
+
+private:
+  void
+  place(TimingWheelHook& hook) noexcept
+  {
+    if (hook.wheelTick <= m_currentTick) {
+      link(hook, DUE_LIST);
+      return;
+    }
+
+    // the level is determined by the most significant slot index that differs
+    uint64_t diff = hook.wheelTick ^ m_currentTick;
+    unsigned level = (63 - static_cast<unsigned>(__builtin_clzll(diff))) / SLOT_BITS;
+    if (level >= N_LEVELS) {
+      link(hook, OVERFLOW_LIST);
+      return;
+    }
+    size_t slot = (hook.wheelTick >> (level * SLOT_BITS)) & (N_SLOTS - 1);
+    link(hook, static_cast<uint16_t>(level * N_SLOTS + slot));
+    m_bitmaps[level] |= uint64_t(1) << slot;
+  }
+
+  /**
+   * \brief Re-place the objects in the slots that begin at the current tick.
+   */
+  void
+  cascade() noexcept
+  {
+    auto replaceAll = [this] (uint16_t listIndex) {
+      TimingWheelHook* hook = std::exchange(m_lists[listIndex], nullptr);
+      while (hook != nullptr) {
+        TimingWheelHook* next = hook->wheelNext;
+        hook->wheelPrev = hook->wheelNext = nullptr;
+        place(*hook);
+        hook = next;
+      }
+    };
+
+    if ((m_currentTick & ((uint64_t(1) << (N_LEVELS * SLOT_BITS)) - 1)) == 0) {
+      replaceAll(OVERFLOW_LIST);
+    }
+    for (size_t level = N_LEVELS; level-- > 0;) {
+      unsigned shift = level * SLOT_BITS;
+      if ((m_currentTick & ((uint64_t(1) << shift) - 1)) != 0) {
+        continue;
+      }
+      size_t slot = (m_currentTick >> shift) & (N_SLOTS - 1);
+      if ((m_bitmaps[level] & (uint64_t(1) << slot)) != 0) {
+        m_bitmaps[level] &= ~(uint64_t(1) << slot);
+        replaceAll(static_cast<uint16_t>(level * N_SLOTS + slot));
+      }
+    }
+  }
+
+  void
+  link(TimingWheelHook& hook, uint16_t listIndex) noexcept
+  {
+    TimingWheelHook*& head = m_lists[listIndex];
+    hook.wheelSlot = listIndex;
+    hook.wheelPrev = nullptr;
+    hook.wheelNext = head;
+    if (head != nullptr) {
+      head->wheelPrev = &hook;
+    }
+    head = &hook;
+  }
+
+  void
+  unlink(TimingWheelHook& hook) noexcept
+  {
+    if (hook.wheelPrev != nullptr) {
+      hook.wheelPrev->wheelNext = hook.wheelNext;
+    }
+    else {
+      m_lists[hook.wheelSlot] = hook.wheelNext;
+      if (hook.wheelNext == nullptr && hook.wheelSlot < OVERFLOW_LIST) {
+        size_t level = hook.wheelSlot / N_SLOTS;
+        m_bitmaps[level] &= ~(uint64_t(1) << (hook.wheelSlot % N_SLOTS));
+      }
+    }
+    if (hook.wheelNext != nullptr) {
+      hook.wheelNext->wheelPrev = hook.wheelPrev;
+    }
+    hook.wheelPrev = hook.wheelNext = nullptr;
+    hook.wheelSlot = NOT_LINKED;
+  }
+
+private:
+  std::array<TimingWheelHook*, N_LEVELS * N_SLOTS + 2> m_lists{};
+  std::array<uint64_t, N_LEVELS> m_bitmaps{};
+  uint64_t m_currentTick = 0;
+  size_t m_size = 0;
+};
+
+} // namespace ndn::detail
+
+#endif // NDN_CXX_UTIL_IMPL_TIMING_WHEEL_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -21,14 +21,18 @@
 
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/impl/steady-timer.hpp"
+#include "ndn-cxx/util/impl/timing-wheel.hpp"
 #include "ndn-cxx/util/scope.hpp"
 
+#include <algorithm>
+#include <tuple>
+
 namespace ndn::scheduler {
 
 /**
  * \brief Stores internal information about a scheduled event.
  */
-struct EventInfo : noncopyable
+struct EventInfo : noncopyable, detail::TimingWheelHook
 {
   EventInfo(time::nanoseconds after, EventCallback&& cb)
     : expiry(time::steady_clock::now() + after)
@@ -40,6 +44,180 @@ struct EventInfo : noncopyable
   EventCallback callback;
   Scheduler::EventQueue::const_iterator queueIt;
   bool isExpired = false;
+
+  // TIMING_WHEEL backend only
+  shared_ptr<EventInfo> wheelOwner; ///< keeps the event alive while it is in the wheel
+  uint64_t seq = 0; ///< orders events with the same expiry time
+};
+
+namespace {
+
+/**
+ * \brief Recycles the memory blocks of EventInfo objects.
+ *
+ * Blocks have the size of the first allocation, which is that of the control block created by
+ * std::allocate_shared; allocations of other sizes are passed through to operator new.
+ */
+class EventPool : noncopyable
+{
+public:
+  ~EventPool()
+  {
+    while (m_freeList != nullptr) {
+      ::operator delete(std::exchange(m_freeList, m_freeList->next));
+    }
+  }
+
+  void*
+  allocate(size_t size)
+  {
+    if (m_blockSize == 0 && size >= sizeof(FreeBlock)) {
+      m_blockSize = size;
+    }
+    if (size != m_blockSize) {
+      return ::operator new(size);
+    }
+    if (m_freeList != nullptr) {
+      return std::exchange(m_freeList, m_freeList->next);
+    }
+    return ::operator new(size);
+  }
+
+  void
+  deallocate(void* p, size_t size) noexcept
+  {
+    if (size != m_blockSize) {
+      ::operator delete(p);
+      return;
+    }
+    m_freeList = new (p) FreeBlock{m_freeList};
+  }
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  FreeBlock* m_freeList = nullptr;
+  size_t m_blockSize = 0;
+};
+
+/**
+ * \brief Allocator that obtains memory from an EventPool.
+ *
+ * The pool is co-owned by every allocated object, so that it outlives the Scheduler as long as
+ * an EventId refers to one of its events.
+ */
+template<typename T>
+class EventAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  EventAllocator(shared_ptr<EventPool> pool) noexcept
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  EventAllocator(const EventAllocator<U>& other) noexcept
+    : m_pool(other.m_pool)
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    m_pool->deallocate(p, n * sizeof(T));
+  }
+
+  template<typename U>
+  bool
+  operator==(const EventAllocator<U>& other) const noexcept
+  {
+    return m_pool == other.m_pool;
+  }
+
+  template<typename U>
+  bool
+  operator!=(const EventAllocator<U>& other) const noexcept
+  {
+    return m_pool != other.m_pool;
+  }
+
+private:
+  shared_ptr<EventPool> m_pool;
+
+  template<typename U>
+  friend class EventAllocator;
+};
+
+} // namespace
+
+/**
+ * \brief State of the TIMING_WHEEL backend.
+ */
+struct Scheduler::Wheel
+{
+  ~Wheel()
+  {
+    clear();
+  }
+
+  uint64_t
+  toTick(time::steady_clock::time_point tp, bool roundUp) const
+  {
+    auto d = time::duration_cast<time::nanoseconds>(tp - epoch);
+    if (d <= 0_ns) {
+      return 0;
+    }
+    auto tick = static_cast<uint64_t>(d / TIMING_WHEEL_TICK);
+    if (roundUp && d % TIMING_WHEEL_TICK != 0_ns) {
+      ++tick;
+    }
+    return tick;
+  }
+
+  /**
+   * \brief Whether some events have been taken out of the wheel but have not been executed.
+   */
+  bool
+  hasPendingBatch() const noexcept
+  {
+    return nextInBatch < batch.size();
+  }
+
+  void
+  clear()
+  {
+    // events are released only after both containers have been emptied,
+    // because destroying their callbacks may cancel other events
+    std::vector<shared_ptr<EventInfo>> released;
+    released.reserve(wheel.size());
+    wheel.clear([&] (detail::TimingWheelHook& hook) {
+      released.push_back(std::move(static_cast<EventInfo&>(hook).wheelOwner));
+    });
+    released.insert(released.end(), std::make_move_iterator(batch.begin() + nextInBatch),
+                    std::make_move_iterator(batch.end()));
+    batch.clear();
+    nextInBatch = 0;
+  }
+
+  const time::steady_clock::time_point epoch = time::steady_clock::now();
+  detail::TimingWheel wheel;
+  shared_ptr<EventPool> pool = make_shared<EventPool>();
+  std::vector<shared_ptr<EventInfo>> batch; ///< expired events being executed
+  size_t nextInBatch = 0;
+  std::optional<uint64_t> armedTick; ///< tick at which the timer is armed to expire
+  uint64_t nextSeq = 0;
 };
 
 EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
@@ -67,18 +245,45 @@ Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
   return a->expiry < b->expiry;
 }
 
-Scheduler::Scheduler(boost::asio::io_context& ioCtx)
+Scheduler::Scheduler(boost::asio::io_context& ioCtx, Backend backend)
   : m_timer(make_unique<detail::SteadyTimer>(ioCtx))
 {
+  if (backend == Backend::TIMING_WHEEL) {
+    m_wheel = make_unique<Wheel>();
+  }
 }
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler()
+{
+  if (m_wheel != nullptr) {
+    m_wheel->clear();
+  }
+}
 
 EventId
 Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
+  if (m_wheel != nullptr) {
+    auto& w = *m_wheel;
+    auto info = std::allocate_shared<EventInfo>(EventAllocator<EventInfo>(w.pool),
+                                                after, std::move(callback));
+    if (w.wheel.empty()) {
+      // keep the wheel close to the present, so that the new event lands on a low level
+      w.wheel.setCurrentTick(std::max(w.wheel.getCurrentTick(), w.toTick(time::steady_clock::now(), false)));
+    }
+    info->wheelTick = w.toTick(info->expiry, true);
+    info->seq = w.nextSeq++;
+    w.wheel.insert(*info);
+    info->wheelOwner = info;
+
+    if (!m_isEventExecuting) {
+      scheduleNext();
+    }
+    return EventId(*this, info);
+  }
+
   auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
   (*i)->queueIt = i;
 
@@ -97,6 +302,23 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
     return;
   }
 
+  if (m_wheel != nullptr) {
+    if (info->wheelSlot != detail::TimingWheelHook::NOT_LINKED) {
+      m_wheel->wheel.erase(*info);
+      info->wheelOwner.reset();
+    }
+    else {
+      // the event is in the batch being executed
+      info->isExpired = true;
+    }
+
+    if (m_wheel->wheel.empty() && !m_wheel->hasPendingBatch()) {
+      m_timer->cancel();
+      m_wheel->armedTick.reset();
+    }
+    return;
+  }
+
   if (info->queueIt == m_queue.begin()) {
     m_timer->cancel();
   }
@@ -111,12 +333,28 @@ void
 Scheduler::cancelAllEvents()
 {
   m_queue.clear();
+  if (m_wheel != nullptr) {
+    m_wheel->clear();
+    m_wheel->armedTick.reset();
+  }
   m_timer->cancel();
 }
 
 void
 Scheduler::scheduleNext()
 {
+  if (m_wheel != nullptr) {
+    auto& w = *m_wheel;
+    auto next = w.hasPendingBatch() ? w.wheel.getCurrentTick() : w.wheel.getNextTick();
+    // an earlier timer expiry is harmless, thus the timer is not rearmed for a later tick
+    if (next && (!w.armedTick || *next < *w.armedTick)) {
+      w.armedTick = next;
+      m_timer->expires_at(w.epoch + static_cast<int64_t>(*next) * TIMING_WHEEL_TICK);
+      m_timer->async_wait([this] (const auto& error) { executeEvent(error); });
+    }
+    return;
+  }
+
   if (!m_queue.empty()) {
     m_timer->expires_at((*m_queue.begin())->expiry);
     m_timer->async_wait([this] (const auto& error) { executeEvent(error); });
@@ -136,6 +374,11 @@ Scheduler::executeEvent(const boost::system::error_code& error)
   });
   m_isEventExecuting = true;
 
+  if (m_wheel != nullptr) {
+    executeWheelEvents();
+    return;
+  }
+
   // process all expired events
   auto now = time::steady_clock::now();
   while (!m_queue.empty()) {
@@ -151,4 +394,34 @@ Scheduler::executeEvent(const boost::system::error_code& error)
   }
 }
 
+void
+Scheduler::executeWheelEvents()
+{
+  auto& w = *m_wheel;
+  w.armedTick.reset();
+
+  if (!w.hasPendingBatch()) {
+    w.batch.clear();
+    w.nextInBatch = 0;
+    w.wheel.advance(w.toTick(time::steady_clock::now(), false), [&w] (detail::TimingWheelHook& hook) {
+      w.batch.push_back(std::move(static_cast<EventInfo&>(hook).wheelOwner));
+    });
+    std::sort(w.batch.begin(), w.batch.end(), [] (const auto& a, const auto& b) {
+      return std::tie(a->expiry, a->seq) < std::tie(b->expiry, b->seq);
+    });
+  }
+
+  // if a callback throws, the rest of the batch is executed in the next invocation
+  while (w.hasPendingBatch()) {
+    shared_ptr<EventInfo> info = std::move(w.batch[w.nextInBatch++]);
+    if (info->isExpired) { // cancelled
+      continue;
+    }
+    info->isExpired = true;
+    info->callback();
+  }
+  w.batch.clear();
+  w.nextInBatch = 0;
+}
+
 } // namespace ndn::scheduler
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -137,8 +137,34 @@ using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 class Scheduler : noncopyable
 {
 public:
+  /**
+   * \brief Data structure that keeps the scheduled events.
+   */
+  enum class Backend {
+    /**
+     * \brief Events are kept in a balanced search tree ordered by expiry time.
+     *
+     * Scheduling and canceling an event take O(log n) time. Each event expires exactly
+     * at its expiry time.
+     */
+    SORTED_QUEUE,
+    /**
+     * \brief Events are kept in a hierarchical timing wheel with a resolution of TIMING_WHEEL_TICK.
+     *
+     * Scheduling and canceling an event take O(1) time, and event storage is recycled. An event
+     * may expire up to one tick later than its expiry time. Events that expire in the same tick
+     * are executed in order of their expiry time.
+     */
+    TIMING_WHEEL,
+  };
+
+  /**
+   * \brief Resolution of the TIMING_WHEEL backend.
+   */
+  static constexpr time::nanoseconds TIMING_WHEEL_TICK = 1_ms;
+
   explicit
-  Scheduler(boost::asio::io_context& ioCtx);
+  Scheduler(boost::asio::io_context& ioCtx, Backend backend = Backend::SORTED_QUEUE);
 
   ~Scheduler();
 
@@ -155,10 +181,21 @@ public:
   void
   cancelAllEvents();
 
+  Backend
+  getBackend() const noexcept
+  {
+    return m_wheel == nullptr ? Backend::SORTED_QUEUE : Backend::TIMING_WHEEL;
+  }
+
 private:
   void
   cancelImpl(const shared_ptr<EventInfo>& info);
 
+  /** \brief Execute expired events of the TIMING_WHEEL backend
+   */
+  void
+  executeWheelEvents();
+
   /** \brief Schedule the next event on the internal timer
    */
   void
@@ -183,6 +220,9 @@ private:
   using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
   EventQueue m_queue;
 
+  struct Wheel;
+  unique_ptr<Wheel> m_wheel; ///< state of TIMING_WHEEL backend, nullptr for SORTED_QUEUE backend
+
   unique_ptr<detail::SteadyTimer> m_timer;
   bool m_isEventExecuting = false;
 
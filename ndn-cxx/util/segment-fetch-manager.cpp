@@ -0,0 +1,67 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/segment-fetch-manager.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+SegmentFetchManager::SegmentFetchManager(Face& face, security::Validator& validator,
+                                         const SegmentFetcher::Options& options)
+  : m_face(face)
+  , m_validator(validator)
+  , m_options(options)
+{
+  m_options.validate();
+}
+
+shared_ptr<SegmentFetcher>
+SegmentFetchManager::start(const Interest& baseInterest, const Name& producerPrefix,
+                           const SegmentFetcher::Options& options)
+{
+  // forget the producers whose fetchers are all gone
+  for (auto it = m_windows.begin(); it != m_windows.end();) {
+    if (it->second.expired()) {
+      it = m_windows.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  auto& entry = m_windows[producerPrefix];
+  auto window = entry.lock();
+  if (window == nullptr) {
+    window = SegmentFetcher::makeSharedWindow(m_options);
+    entry = window;
+  }
+  return SegmentFetcher::start(m_face, baseInterest, m_validator, options, window);
+}
+
+size_t
+SegmentFetchManager::getNProducers() const
+{
+  return std::count_if(m_windows.begin(), m_windows.end(),
+                       [] (const auto& entry) { return !entry.second.expired(); });
+}
+
+} // namespace ndn
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_SEGMENT_FETCH_MANAGER_HPP
+#define NDN_CXX_UTIL_SEGMENT_FETCH_MANAGER_HPP
+
+#include "ndn-cxx/util/segment-fetcher.hpp"
+
+#include <map>
+
+namespace ndn {
+
+/**
+ * @brief Fetches many segmented objects concurrently, with one congestion controller per producer.
+ *
+ * Each object is retrieved by a SegmentFetcher, which behaves as described in the SegmentFetcher
+ * documentation, except for congestion control. All fetchers started with the same producer
+ * prefix share one congestion window and one RTT estimator, so that fetching many small objects
+ * from a producer does not run a separate slow start for each object, and the total number of
+ * Interests in flight towards the producer is bounded by the shared window. Whenever the window
+ * has room, the fetchers take turns in sending one Interest each, so that concurrent objects
+ * progress at the same pace.
+ *
+ * The congestion controller of a producer is kept as long as one of the fetchers that use it
+ * exists, and is reused by the fetchers of the same producer that are started in the meantime.
+ *
+ * Example:
+ * @code
+ * SegmentFetchManager manager(face, validator);
+ * for (const auto& name : objectNames) {
+ *   auto fetcher = manager.start(Interest(name), "/producer");
+ *   fetcher->onComplete.connect([] (ConstBufferPtr data) {...});
+ *   fetcher->onError.connect([] (uint32_t errorCode, const std::string& errorMsg) {...});
+ * }
+ * @endcode
+ */
+class SegmentFetchManager : noncopyable
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param face      Face used by all fetchers.
+   * @param validator Validator used by all fetchers, which must remain valid until all fetchers
+   *                  have signaled completion or failure.
+   * @param options   Options of the congestion controllers (window and RTT estimator parameters),
+   *                  and default options of the fetchers.
+   */
+  SegmentFetchManager(Face& face, security::Validator& validator,
+                      const SegmentFetcher::Options& options = {});
+
+  /**
+   * @brief Initiates fetching of a segmented object.
+   *
+   * @param baseInterest   Interest for the initial segment of requested data, see SegmentFetcher::start().
+   * @param producerPrefix Identifies the producer, whose congestion controller is used.
+   *                       It should be a prefix of the name of @p baseInterest.
+   * @param options        Options of this fetch. The parameters of the congestion window and RTT
+   *                       estimator are ignored, as they are taken from the SegmentFetchManager.
+   * @return The SegmentFetcher of the object, which is kept alive until the transfer ends.
+   */
+  shared_ptr<SegmentFetcher>
+  start(const Interest& baseInterest, const Name& producerPrefix,
+        const SegmentFetcher::Options& options);
+
+  shared_ptr<SegmentFetcher>
+  start(const Interest& baseInterest, const Name& producerPrefix)
+  {
+    return start(baseInterest, producerPrefix, m_options);
+  }
+
+  /**
+   * @brief Returns the number of producers that have a congestion controller.
+   */
+  size_t
+  getNProducers() const;
+
+private:
+  Face& m_face;
+  security::Validator& m_validator;
+  SegmentFetcher::Options m_options;
+  /// owned by the fetchers, so that the entry of a producer expires with its last fetcher
+  std::map<Name, weak_ptr<SegmentFetcher::SharedWindow>> m_windows;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_SEGMENT_FETCH_MANAGER_HPP
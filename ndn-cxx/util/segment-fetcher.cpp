@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California,
+ * Copyright (c) 2013-2025 Regents of the University of California,
  *                         Colorado State University,
  *                         University Pierre & Marie Curie, Sorbonne University.
  *
@@ -23,7 +23,6 @@
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
 
@@ -33,7 +32,12 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstring>
+#include <system_error>
+
+#include <unistd.h>
 
 namespace ndn {
 
@@ -55,11 +59,107 @@ SegmentFetcher::Options::validate()
   if (mdCoef < 0.0 || mdCoef > 1.0) {
     NDN_THROW(std::invalid_argument("mdCoef must be in range [0, 1]"));
   }
+
+  if (flowControlWindow == 0) {
+    NDN_THROW(std::invalid_argument("flowControlWindow must be greater than 0"));
+  }
+
+  if (sink && inOrder) {
+    NDN_THROW(std::invalid_argument("sink cannot be used in 'in order' mode"));
+  }
+}
+
+/**
+ * @brief Congestion window and RTT estimator shared by the fetchers of SegmentFetchManager that
+ *        retrieve objects from the same producer.
+ *
+ * Interests are numbered in the order they are sent by any of the fetchers, and the conservative
+ * window adaptation operates on these numbers instead of segment numbers.
+ */
+class SegmentFetcher::SharedWindow : public std::enable_shared_from_this<SharedWindow>, noncopyable
+{
+public:
+  explicit
+  SharedWindow(const Options& options)
+    : options(options)
+    , rttEstimator(make_shared<util::RttEstimator::Options>(options.rttOptions))
+    , cwnd(options.initCwnd)
+    , ssthresh(options.initSsthresh)
+  {
+  }
+
+  void
+  add(const shared_ptr<SegmentFetcher>& fetcher)
+  {
+    m_fetchers.push_back(fetcher);
+  }
+
+  /**
+   * @brief Let the fetchers send Interests, one at a time in round-robin order, until the window
+   *        is full or none of them has anything to send.
+   */
+  void
+  schedule();
+
+public:
+  const Options options;
+  util::RttEstimator rttEstimator;
+  double cwnd;
+  double ssthresh;
+  uint64_t highInterest = 0;
+  uint64_t highData = 0;
+  uint64_t recPoint = 0;
+
+private:
+  std::vector<weak_ptr<SegmentFetcher>> m_fetchers;
+  size_t m_next = 0; ///< round-robin position in m_fetchers, may be equal to its size
+  bool m_isScheduling = false;
+};
+
+void
+SegmentFetcher::SharedWindow::schedule()
+{
+  if (m_isScheduling) {
+    return;
+  }
+  m_isScheduling = true;
+  auto self = shared_from_this();
+
+  // drop finished fetchers, and rotate the list so that the round robin continues where it stopped
+  std::vector<shared_ptr<SegmentFetcher>> active;
+  active.reserve(m_fetchers.size());
+  int64_t nInFlight = 0;
+  for (size_t i = 0; i < m_fetchers.size(); ++i) {
+    auto fetcher = m_fetchers[(m_next + i) % m_fetchers.size()].lock();
+    if (fetcher != nullptr && fetcher->m_this != nullptr) {
+      nInFlight += fetcher->m_nSegmentsInFlight;
+      active.push_back(std::move(fetcher));
+    }
+  }
+  m_fetchers.assign(active.begin(), active.end());
+  m_next = 0;
+
+  for (size_t nIdle = 0; nInFlight < static_cast<int64_t>(cwnd) && nIdle < active.size();) {
+    // m_next is not wrapped here, so that fetchers added later get their turn before
+    // the round robin starts over
+    auto& fetcher = active[m_next % active.size()];
+    m_next = m_next % active.size() + 1;
+    if (fetcher->m_this != nullptr && fetcher->sendNextSegment()) {
+      ++nInFlight;
+      nIdle = 0;
+    }
+    else {
+      ++nIdle;
+    }
+  }
+
+  m_isScheduling = false;
 }
 
 SegmentFetcher::SegmentFetcher(Face& face,
                                security::Validator& validator,
-                               const SegmentFetcher::Options& options)
+                               const SegmentFetcher::Options& options,
+                               shared_ptr<SharedWindow> sharedWindow)
   : m_options(options)
   , m_face(face)
   , m_scheduler(m_face.getIoContext())
@@ -68,6 +168,7 @@ SegmentFetcher::SegmentFetcher(Face& face,
   , m_timeLastSegmentReceived(time::steady_clock::now())
   , m_cwnd(options.initCwnd)
   , m_ssthresh(options.initSsthresh)
+  , m_sharedWindow(std::move(sharedWindow))
 {
   m_options.validate();
 }
@@ -84,6 +185,29 @@ SegmentFetcher::start(Face& face,
   return fetcher;
 }
 
+shared_ptr<SegmentFetcher>
+SegmentFetcher::start(Face& face,
+                      const Interest& baseInterest,
+                      security::Validator& validator,
+                      const SegmentFetcher::Options& options,
+                      const shared_ptr<SharedWindow>& sharedWindow)
+{
+  BOOST_ASSERT(sharedWindow != nullptr);
+  shared_ptr<SegmentFetcher> fetcher(new SegmentFetcher(face, validator, options, sharedWindow));
+  fetcher->m_this = fetcher;
+  // the first Interest is sent when the shared window has room for it
+  fetcher->m_interestTemplate = baseInterest;
+  sharedWindow->add(fetcher);
+  sharedWindow->schedule();
+  return fetcher;
+}
+
+shared_ptr<SegmentFetcher::SharedWindow>
+SegmentFetcher::makeSharedWindow(const Options& options)
+{
+  return std::make_shared<SharedWindow>(options);
+}
+
 void
 SegmentFetcher::stop()
 {
@@ -92,7 +216,60 @@ SegmentFetcher::stop()
   }
 
   m_pendingSegments.clear(); // cancels pending Interests and timeout events
+  m_pendingValidations.clear(); // results of validations still in progress are discarded
   boost::asio::post(m_face.getIoContext(), [self = std::move(m_this)] {});
+
+  if (m_sharedWindow != nullptr) {
+    // give the share of this fetcher to the others
+    m_sharedWindow->schedule();
+  }
+}
+
+SegmentFetcher::Options::Sink
+SegmentFetcher::makeFileSink(int fd, size_t segmentSize)
+{
+  if (segmentSize == 0) {
+    NDN_THROW(std::invalid_argument("segmentSize must be greater than 0"));
+  }
+
+  return [fd, segmentSize] (uint64_t segmentNo, span<const uint8_t> content) {
+    if (content.size() > segmentSize) {
+      NDN_THROW(std::length_error("Segment " + std::to_string(segmentNo) + " is larger than " +
+                                  std::to_string(segmentSize) + " octets"));
+    }
+    auto offset = static_cast<off_t>(segmentNo * segmentSize);
+    while (!content.empty()) {
+      auto n = ::pwrite(fd, content.data(), content.size(), offset);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        NDN_THROW(std::system_error(errno, std::system_category(), "pwrite"));
+      }
+      content = content.subspan(static_cast<size_t>(n));
+      offset += n;
+    }
+  };
+}
+
+SegmentFetcher::Options::Sink
+SegmentFetcher::makeMemorySink(span<uint8_t> region, size_t segmentSize)
+{
+  if (segmentSize == 0) {
+    NDN_THROW(std::invalid_argument("segmentSize must be greater than 0"));
+  }
+
+  return [region, segmentSize] (uint64_t segmentNo, span<const uint8_t> content) {
+    if (content.size() > segmentSize) {
+      NDN_THROW(std::length_error("Segment " + std::to_string(segmentNo) + " is larger than " +
+                                  std::to_string(segmentSize) + " octets"));
+    }
+    if (segmentNo > region.size() / segmentSize ||
+        region.size() - segmentNo * segmentSize < content.size()) {
+      NDN_THROW(std::out_of_range("Segment " + std::to_string(segmentNo) + " does not fit in the region"));
+    }
+    std::memcpy(region.data() + segmentNo * segmentSize, content.data(), content.size());
+  };
 }
 
 bool
@@ -129,18 +306,34 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
     return finalizeFetch();
   }
 
-  int64_t availableWindowSize;
-  if (m_options.inOrder) {
-    availableWindowSize = std::min<int64_t>(m_cwnd, m_options.flowControlWindow - m_segmentBuffer.size());
-  }
-  else {
-    availableWindowSize = static_cast<int64_t>(m_cwnd);
+  if (m_sharedWindow != nullptr) {
+    // segment Interests are derived from m_interestTemplate
+    return m_sharedWindow->schedule();
   }
+
+  int64_t availableWindowSize = std::min<int64_t>(m_cwnd, static_cast<int64_t>(m_options.flowControlWindow) -
+                                                           static_cast<int64_t>(getNBufferedSegments()));
   availableWindowSize -= m_nSegmentsInFlight;
 
   std::vector<std::pair<uint64_t, bool>> segmentsToRequest; // The boolean indicates whether a retx or not
 
-  while (availableWindowSize > 0) {
+  for (; availableWindowSize > 0; availableWindowSize--) {
+    auto segment = getNextSegmentToRequest();
+    if (!segment) {
+      break;
+    }
+    segmentsToRequest.push_back(*segment);
+  }
+
+  for (const auto& segment : segmentsToRequest) {
+    sendSegmentInterest(origInterest, segment.first, segment.second);
+  }
+}
+
+std::optional<std::pair<uint64_t, bool>>
+SegmentFetcher::getNextSegmentToRequest()
+{
+  while (true) {
     if (!m_retxQueue.empty()) {
       auto pendingSegmentIt = m_pendingSegments.find(m_retxQueue.front());
       m_retxQueue.pop();
@@ -149,31 +342,72 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
         continue;
       }
       BOOST_ASSERT(pendingSegmentIt->second.state == SegmentState::InRetxQueue);
-      segmentsToRequest.emplace_back(pendingSegmentIt->first, true);
+      return std::pair(pendingSegmentIt->first, true);
     }
     else if (m_nSegments == 0 || m_nextSegmentNum < static_cast<uint64_t>(m_nSegments)) {
-      if (m_segmentBuffer.count(m_nextSegmentNum) > 0) {
+      if (m_receivedSegments.count(m_nextSegmentNum) > 0) {
         // Don't request a segment a second time if received in response to first "discovery" Interest
         m_nextSegmentNum++;
         continue;
       }
-      segmentsToRequest.emplace_back(m_nextSegmentNum++, false);
+      return std::pair(m_nextSegmentNum++, false);
     }
     else {
-      break;
+      return std::nullopt;
     }
-    availableWindowSize--;
   }
+}
 
-  for (const auto& segment : segmentsToRequest) {
-    Interest interest(origInterest); // to preserve Interest elements
-    interest.setName(Name(m_versionedDataName).appendSegment(segment.first));
-    interest.setCanBePrefix(false);
-    interest.setMustBeFresh(false);
-    interest.setInterestLifetime(m_options.interestLifetime);
-    interest.refreshNonce();
-    sendInterest(segment.first, interest, segment.second);
+size_t
+SegmentFetcher::getNBufferedSegments() const
+{
+  // in 'block' mode, m_segmentBuffer holds the whole object and is not limited by the window
+  return m_pendingValidations.size() + (m_options.inOrder ? m_segmentBuffer.size() : 0);
+}
+
+bool
+SegmentFetcher::sendNextSegment()
+{
+  BOOST_ASSERT(m_sharedWindow != nullptr);
+  if (!m_interestTemplate) {
+    return false;
   }
+
+  if (m_receivedSegments.empty()) {
+    // the version is unknown until the first segment has been received
+    if (m_pendingSegments.empty()) {
+      fetchFirstSegment(*m_interestTemplate, false);
+      return true;
+    }
+    if (m_pendingSegments.begin()->second.state == SegmentState::InRetxQueue) {
+      fetchFirstSegment(*m_interestTemplate, true);
+      return true;
+    }
+    return false;
+  }
+
+  if (getNBufferedSegments() + static_cast<size_t>(m_nSegmentsInFlight) >= m_options.flowControlWindow) {
+    return false;
+  }
+
+  auto segment = getNextSegmentToRequest();
+  if (!segment) {
+    return false;
+  }
+  sendSegmentInterest(*m_interestTemplate, segment->first, segment->second);
+  return true;
+}
+
+void
+SegmentFetcher::sendSegmentInterest(const Interest& origInterest, uint64_t segNum, bool isRetransmission)
+{
+  Interest interest(origInterest); // to preserve Interest elements
+  interest.setName(Name(m_versionedDataName).appendSegment(segNum));
+  interest.setCanBePrefix(false);
+  interest.setMustBeFresh(false);
+  interest.setInterestLifetime(m_options.interestLifetime);
+  interest.refreshNonce();
+  sendInterest(segNum, interest, isRetransmission);
 }
 
 void
@@ -196,13 +430,15 @@ SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isR
     afterTimeoutCb(interest, weakSelf);
   });
 
+  uint64_t windowSeq = m_sharedWindow == nullptr ? 0 : ++m_sharedWindow->highInterest;
+
   if (isRetransmission) {
-    updateRetransmittedSegment(segNum, pendingInterest, timeoutEvent);
+    updateRetransmittedSegment(segNum, pendingInterest, timeoutEvent, windowSeq);
     return;
   }
 
   PendingSegment pendingSegment{SegmentState::FirstInterest, time::steady_clock::now(),
-                                pendingInterest, timeoutEvent};
+                                pendingInterest, timeoutEvent, windowSeq};
   bool isNew = m_pendingSegments.try_emplace(segNum, std::move(pendingSegment)).second;
   BOOST_VERIFY(isNew);
   m_highInterest = segNum;
@@ -215,9 +451,6 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
   if (shouldStop(weakSelf))
     return;
 
-  BOOST_ASSERT(m_nSegmentsInFlight > 0);
-  m_nSegmentsInFlight--;
-
   name::Component currentSegmentComponent = data.getName().get(-1);
   if (!currentSegmentComponent.isSegment()) {
     return signalError(DATA_HAS_NO_SEGMENT, "Data Name has no segment number");
@@ -235,73 +468,80 @@ SegmentFetcher::afterSegmentReceivedCb(const Interest& origInterest, const Data&
   }
 
   if (pendingSegmentIt == m_pendingSegments.end()) {
+    // The Interest was canceled by cancelExcessInFlightSegments() after the Data had arrived,
+    // and it is no longer counted as in flight
     return;
   }
 
+  BOOST_ASSERT(m_nSegmentsInFlight > 0);
+  m_nSegmentsInFlight--;
   pendingSegmentIt->second.timeoutEvent.cancel();
 
   afterSegmentReceived(data);
+  if (shouldStop(weakSelf))
+    return;
+  acceptSegment(data, pendingSegmentIt);
 
+  auto pv = m_pendingValidations.emplace_back(
+    std::make_shared<PendingValidation>(PendingValidation{data, origInterest, false, std::nullopt}));
   m_validator.validate(data,
-    [=] (const Data& d) { afterValidationSuccess(d, origInterest, pendingSegmentIt, weakSelf); },
-    [=] (const Data& d, const auto& error) { afterValidationFailure(d, error, weakSelf); });
+    [this, pv, weakSelf] (const Data&) {
+      if (shouldStop(weakSelf))
+        return;
+      pv->isDone = true;
+      applyValidationResults();
+    },
+    [this, pv, weakSelf] (const Data&, const security::ValidationError& error) {
+      if (shouldStop(weakSelf))
+        return;
+      pv->isDone = true;
+      pv->error = error;
+      applyValidationResults();
+    });
+
+  if (!shouldStop(weakSelf) && !m_pendingValidations.empty()) {
+    // keep sending Interests while the validator works asynchronously, as long as the segments
+    // waiting for validation leave room in the flow control window
+    fetchSegmentsInWindow(origInterest);
+  }
 }
 
 void
-SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInterest,
-                                       std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
-                                       const weak_ptr<SegmentFetcher>& weakSelf)
+SegmentFetcher::acceptSegment(const Data& data,
+                              std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt)
 {
-  if (shouldStop(weakSelf))
-    return;
-
-  // We update the last receive time here instead of in the segment received callback so that the
-  // transfer will not fail to terminate if we only received invalid Data packets.
-  m_timeLastSegmentReceived = time::steady_clock::now();
-
-  m_nReceived++;
-
   // It was verified in afterSegmentReceivedCb that the last Data name component is a segment number
   uint64_t currentSegment = data.getName().get(-1).toSegment();
-  m_receivedSegments.insert(currentSegment);
 
   // Add measurement to RTO estimator (if not retransmission)
   if (pendingSegmentIt->second.state == SegmentState::FirstInterest) {
     BOOST_ASSERT(m_nSegmentsInFlight >= 0);
-    m_rttEstimator.addMeasurement(m_timeLastSegmentReceived - pendingSegmentIt->second.sendTime,
-                                  static_cast<size_t>(m_nSegmentsInFlight) + 1);
+    // with a shared window, the number of samples per RTT is approximated by the window size
+    size_t nExpectedSamples = m_sharedWindow == nullptr ? static_cast<size_t>(m_nSegmentsInFlight) + 1 :
+                              std::max<size_t>(static_cast<size_t>(m_sharedWindow->cwnd), 1);
+    getRttEstimator().addMeasurement(time::steady_clock::now() - pendingSegmentIt->second.sendTime,
+                                     nExpectedSamples);
+  }
+
+  if (m_sharedWindow != nullptr) {
+    m_sharedWindow->highData = std::max(m_sharedWindow->highData, pendingSegmentIt->second.windowSeq);
   }
 
   // Remove from pending segments map
   m_pendingSegments.erase(pendingSegmentIt);
 
-  // Copy data in segment to temporary buffer
-  auto receivedSegmentIt = m_segmentBuffer.try_emplace(currentSegment, data.getContent().value_size())
-                           .first;
-  std::copy(data.getContent().value_begin(), data.getContent().value_end(),
-            receivedSegmentIt->second.begin());
-  m_nBytesReceived += data.getContent().value_size();
-  afterSegmentValidated(data);
-
-  if (data.getFinalBlock()) {
-    if (!data.getFinalBlock()->isSegment()) {
-      return signalError(FINALBLOCKID_NOT_SEGMENT,
-                         "Received FinalBlockId did not contain a segment component");
-    }
-
-    if (data.getFinalBlock()->toSegment() + 1 != static_cast<uint64_t>(m_nSegments)) {
-      m_nSegments = data.getFinalBlock()->toSegment() + 1;
-      cancelExcessInFlightSegments();
-    }
+  if (m_highData < currentSegment) {
+    m_highData = currentSegment;
   }
 
-  if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
-    do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
-      m_segmentBuffer.erase(m_nextSegmentInOrder++);
-    } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
+  if (data.getCongestionMark() > 0 && !m_options.ignoreCongMarks) {
+    windowDecrease();
+  }
+  else {
+    windowIncrease();
   }
 
+  m_receivedSegments.insert(currentSegment);
   if (m_receivedSegments.size() == 1) {
     m_versionedDataName = data.getName().getPrefix(-1);
     if (currentSegment == 0) {
@@ -310,29 +550,82 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
     }
   }
 
-  if (m_highData < currentSegment) {
-    m_highData = currentSegment;
+  // Stop requesting segments past the end of the object without waiting for the validation.
+  // A FinalBlockId that is not a segment number is reported once the segment has been validated.
+  if (data.getFinalBlock() && data.getFinalBlock()->isSegment() &&
+      data.getFinalBlock()->toSegment() + 1 != static_cast<uint64_t>(m_nSegments)) {
+    m_nSegments = data.getFinalBlock()->toSegment() + 1;
+    cancelExcessInFlightSegments();
   }
+}
 
-  if (data.getCongestionMark() > 0 && !m_options.ignoreCongMarks) {
-    windowDecrease();
+void
+SegmentFetcher::consumeSegment(const Data& data, const Interest& origInterest)
+{
+  weak_ptr<SegmentFetcher> weakSelf = m_this;
+
+  // We update the last receive time here instead of in the segment received callback so that the
+  // transfer will not fail to terminate if we only received invalid Data packets.
+  m_timeLastSegmentReceived = time::steady_clock::now();
+
+  m_nReceived++;
+
+  uint64_t currentSegment = data.getName().get(-1).toSegment();
+  m_nBytesReceived += data.getContent().value_size();
+  if (!m_options.sink) {
+    // Copy data in segment to temporary buffer
+    auto receivedSegmentIt = m_segmentBuffer.try_emplace(currentSegment, data.getContent().value_size())
+                             .first;
+    std::copy(data.getContent().value_begin(), data.getContent().value_end(),
+              receivedSegmentIt->second.begin());
   }
-  else {
-    windowIncrease();
+  afterSegmentValidated(data);
+
+  if (data.getFinalBlock() && !data.getFinalBlock()->isSegment()) {
+    return signalError(FINALBLOCKID_NOT_SEGMENT,
+                       "Received FinalBlockId did not contain a segment component");
+  }
+
+  if (m_options.sink && (m_nSegments == 0 || currentSegment < static_cast<uint64_t>(m_nSegments))) {
+    // Segments beyond the end of the object are not passed to the sink
+    try {
+      m_options.sink(currentSegment, data.getContent().value_bytes());
+    }
+    catch (const std::exception& e) {
+      return signalError(SINK_ERROR, "Sink failed to consume segment " + std::to_string(currentSegment) +
+                         ": " + e.what());
+    }
+    if (shouldStop(weakSelf))
+      return;
+  }
+
+  if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
+    do {
+      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
+      m_segmentBuffer.erase(m_nextSegmentInOrder++);
+    } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
   }
 
   fetchSegmentsInWindow(origInterest);
 }
 
 void
-SegmentFetcher::afterValidationFailure(const Data&,
-                                       const security::ValidationError& error,
-                                       const weak_ptr<SegmentFetcher>& weakSelf)
+SegmentFetcher::applyValidationResults()
 {
-  if (shouldStop(weakSelf))
-    return;
+  weak_ptr<SegmentFetcher> weakSelf = m_this;
+
+  while (!m_pendingValidations.empty() && m_pendingValidations.front()->isDone) {
+    auto pv = std::move(m_pendingValidations.front());
+    m_pendingValidations.pop_front();
 
-  signalError(SEGMENT_VALIDATION_FAIL, "Segment validation failed: " + boost::lexical_cast<std::string>(error));
+    if (pv->error) {
+      return signalError(SEGMENT_VALIDATION_FAIL, "Segment validation failed: " +
+                         boost::lexical_cast<std::string>(*pv->error));
+    }
+    consumeSegment(pv->data, pv->origInterest);
+    if (shouldStop(weakSelf))
+      return;
+  }
 }
 
 void
@@ -396,11 +689,16 @@ SegmentFetcher::afterNackOrTimeout(const Interest& origInterest)
   pendingSegmentIt->second.timeoutEvent.cancel();
   pendingSegmentIt->second.state = SegmentState::InRetxQueue;
 
-  m_rttEstimator.backoffRto();
+  getRttEstimator().backoffRto();
 
   if (m_receivedSegments.empty()) {
     // Resend first Interest (until maximum receive timeout exceeded)
-    fetchFirstSegment(origInterest, true);
+    if (m_sharedWindow != nullptr) {
+      m_sharedWindow->schedule();
+    }
+    else {
+      fetchFirstSegment(origInterest, true);
+    }
   }
   else {
     windowDecrease();
@@ -415,16 +713,25 @@ SegmentFetcher::finalizeFetch()
   if (m_options.inOrder) {
     onInOrderComplete();
   }
+  else if (m_options.sink) {
+    onSinkComplete();
+  }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
     BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
 
+    // Combine segments into final buffer, which is allocated only once
+    size_t totalSize = 0;
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      totalSize += m_segmentBuffer[i].size();
     }
-    onComplete(buf.buf());
+    auto buf = std::make_shared<Buffer>();
+    buf->reserve(totalSize);
+    for (int64_t i = 0; i < m_nSegments; i++) {
+      buf->insert(buf->end(), m_segmentBuffer[i].begin(), m_segmentBuffer[i].end());
+      m_segmentBuffer.erase(i); // release memory as soon as possible
+    }
+    onComplete(buf);
   }
   stop();
 }
@@ -432,33 +739,57 @@ SegmentFetcher::finalizeFetch()
 void
 SegmentFetcher::windowIncrease()
 {
-  if (m_options.useConstantCwnd) {
-    BOOST_ASSERT(m_cwnd == m_options.initCwnd);
+  if (m_sharedWindow != nullptr) {
+    increaseWindow(m_sharedWindow->options, m_sharedWindow->cwnd, m_sharedWindow->ssthresh);
+  }
+  else {
+    increaseWindow(m_options, m_cwnd, m_ssthresh);
+  }
+}
+
+void
+SegmentFetcher::windowDecrease()
+{
+  if (m_sharedWindow != nullptr) {
+    decreaseWindow(m_sharedWindow->options, m_sharedWindow->cwnd, m_sharedWindow->ssthresh,
+                   m_sharedWindow->highInterest, m_sharedWindow->highData, m_sharedWindow->recPoint);
+  }
+  else {
+    decreaseWindow(m_options, m_cwnd, m_ssthresh, m_highInterest, m_highData, m_recPoint);
+  }
+}
+
+void
+SegmentFetcher::increaseWindow(const Options& options, double& cwnd, double ssthresh)
+{
+  if (options.useConstantCwnd) {
+    BOOST_ASSERT(cwnd == options.initCwnd);
     return;
   }
 
-  if (m_cwnd < m_ssthresh) {
-    m_cwnd += m_options.aiStep; // additive increase
+  if (cwnd < ssthresh) {
+    cwnd += options.aiStep; // additive increase
   }
   else {
-    m_cwnd += m_options.aiStep / std::floor(m_cwnd); // congestion avoidance
+    cwnd += options.aiStep / std::floor(cwnd); // congestion avoidance
   }
 }
 
 void
-SegmentFetcher::windowDecrease()
+SegmentFetcher::decreaseWindow(const Options& options, double& cwnd, double& ssthresh,
+                               uint64_t highInterest, uint64_t highData, uint64_t& recPoint)
 {
-  if (m_options.disableCwa || m_highData > m_recPoint) {
-    m_recPoint = m_highInterest;
+  if (options.disableCwa || highData > recPoint) {
+    recPoint = highInterest;
 
-    if (m_options.useConstantCwnd) {
-      BOOST_ASSERT(m_cwnd == m_options.initCwnd);
+    if (options.useConstantCwnd) {
+      BOOST_ASSERT(cwnd == options.initCwnd);
       return;
     }
 
     // Refer to RFC 5681, Section 3.1 for the rationale behind the code below
-    m_ssthresh = std::max(MIN_SSTHRESH, m_cwnd * m_options.mdCoef); // multiplicative decrease
-    m_cwnd = m_options.resetCwndToInit ? m_options.initCwnd : m_ssthresh;
+    ssthresh = std::max(MIN_SSTHRESH, cwnd * options.mdCoef); // multiplicative decrease
+    cwnd = options.resetCwndToInit ? options.initCwnd : ssthresh;
   }
 }
 
@@ -472,7 +803,8 @@ SegmentFetcher::signalError(uint32_t code, const std::string& msg)
 void
 SegmentFetcher::updateRetransmittedSegment(uint64_t segmentNum,
                                            const PendingInterestHandle& pendingInterest,
-                                           scheduler::EventId timeoutEvent)
+                                           scheduler::EventId timeoutEvent,
+                                           uint64_t windowSeq)
 {
   auto pendingSegmentIt = m_pendingSegments.find(segmentNum);
   BOOST_ASSERT(pendingSegmentIt != m_pendingSegments.end());
@@ -480,6 +812,7 @@ SegmentFetcher::updateRetransmittedSegment(uint64_t segmentNum,
   pendingSegmentIt->second.state = SegmentState::Retransmitted;
   pendingSegmentIt->second.hdl = pendingInterest; // cancels previous pending Interest via scoped handle
   pendingSegmentIt->second.timeoutEvent = timeoutEvent;
+  pendingSegmentIt->second.windowSeq = windowSeq;
 }
 
 void
@@ -502,7 +835,8 @@ SegmentFetcher::checkAllSegmentsReceived()
 {
   bool haveReceivedAllSegments = false;
 
-  if (m_nSegments != 0 && m_nReceived >= m_nSegments) {
+  // segments still being validated are counted in m_receivedSegments but not in m_nReceived
+  if (m_nSegments != 0 && m_nReceived >= m_nSegments && m_pendingValidations.empty()) {
     haveReceivedAllSegments = true;
     // Verify that all segments in window have been received. If not, send Interests for missing segments.
     for (uint64_t i = 0; i < static_cast<uint64_t>(m_nSegments); i++) {
@@ -516,13 +850,19 @@ SegmentFetcher::checkAllSegmentsReceived()
   return haveReceivedAllSegments;
 }
 
+util::RttEstimator&
+SegmentFetcher::getRttEstimator()
+{
+  return m_sharedWindow == nullptr ? m_rttEstimator : m_sharedWindow->rttEstimator;
+}
+
 time::milliseconds
 SegmentFetcher::getEstimatedRto()
 {
   // We don't want an Interest timeout greater than the maximum allowed timeout between the
   // succesful receipt of segments
   return std::min(m_options.maxTimeout,
-                  time::duration_cast<time::milliseconds>(m_rttEstimator.getEstimatedRto()));
+                  time::duration_cast<time::milliseconds>(getRttEstimator().getEstimatedRto()));
 }
 
 } // namespace ndn
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -28,6 +28,7 @@
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/signal/signal.hpp"
 
+#include <deque>
 #include <queue>
 #include <set>
 
@@ -38,6 +39,15 @@ namespace ndn {
  */
 struct SegmentFetcherOptions
 {
+  /**
+   * @brief Function that consumes the content of a segment in 'sink' mode.
+   * @param segmentNo segment number
+   * @param content payload of the segment, valid only until the function returns
+   * @throw std::exception the segment cannot be consumed; the retrieval fails with
+   *                       SegmentFetcher::SINK_ERROR
+   */
+  using Sink = std::function<void(uint64_t segmentNo, span<const uint8_t> content)>;
+
   /// Lifetime of sent Interests (independent of Interest timeout)
   time::milliseconds interestLifetime = 4_s;
   /// Maximum allowed time between successful receipt of segments
@@ -66,8 +76,11 @@ struct SegmentFetcherOptions
   double mdCoef = 0.5;
   /// Options for the RTT estimator
   util::RttEstimator::Options rttOptions;
-  /// Maximum number of segments stored in the reorder buffer
+  /// Maximum number of received segments that are waiting for validation or, in 'in order' mode,
+  /// stored in the reorder buffer
   size_t flowControlWindow = 25000;
+  /// If set, 'sink' mode is used and the content of each segment is passed to this function
+  Sink sink;
 
   void
   validate();
@@ -108,7 +121,10 @@ struct SegmentFetcherOptions
  * 4. If set to 'block' mode, signal #onComplete passing a memory buffer that combines the content
  *    of all segments in the object. If set to 'in order' mode, signal #onInOrderData is triggered
  *    upon validation of each segment in segment order, storing later segments that arrived out of
- *    order internally until all earlier segments have arrived and have been validated.
+ *    order internally until all earlier segments have arrived and have been validated. If set to
+ *    'sink' mode (Options::sink is set), the content of each segment is passed to the sink upon
+ *    validation, in arrival order, and is not stored; #onSinkComplete is signaled at the end.
+ *    The memory used by the retrieval is then bounded by the window instead of the object size.
  *
  * If an error occurs during the fetching process, #onError is signaled with one of the error codes
  * from SegmentFetcher::ErrorCode.
@@ -116,12 +132,27 @@ struct SegmentFetcherOptions
  * A Validator instance must be specified to validate individual segments. Every time a segment has
  * been successfully validated, #afterSegmentValidated will be signaled.
  *
+ * The congestion window is adjusted when a segment is received, and the fetcher keeps sending
+ * Interests while segments are being validated, as long as the segments waiting for validation
+ * fit in Options::flowControlWindow. Validation results are applied in the order in which the
+ * segments were received. To verify the signatures of several segments in parallel,
+ * enable asynchronous verification on the validator (see
+ * security::Validator::enableAsyncVerification).
+ *
  * Example:
  * @code
  * auto fetcher = SegmentFetcher::start(face, Interest("/data/prefix"), validator);
  * fetcher->onComplete.connect([] (ConstBufferPtr data) {...});
  * fetcher->onError.connect([] (uint32_t errorCode, const std::string& errorMsg) {...});
  * @endcode
+ *
+ * Example of writing a large object directly into a file, whose segments are 8000 octets each:
+ * @code
+ * SegmentFetcher::Options options;
+ * options.sink = SegmentFetcher::makeFileSink(fd, 8000);
+ * auto fetcher = SegmentFetcher::start(face, Interest("/data/prefix"), validator, options);
+ * fetcher->onSinkComplete.connect([] {...});
+ * @endcode
  */
 class SegmentFetcher : noncopyable
 {
@@ -140,6 +171,8 @@ public:
     NACK_ERROR = 4,
     /// A received FinalBlockId did not contain a segment component
     FINALBLOCKID_NOT_SEGMENT = 5,
+    /// The sink failed to consume a segment in 'sink' mode
+    SINK_ERROR = 6,
   };
 
   using Options = SegmentFetcherOptions;
@@ -180,10 +213,47 @@ public:
   void
   stop();
 
+  /**
+   * @brief Returns a sink that writes each segment into a file, at the offset of the segment.
+   *
+   * Segment `N` is written at offset `N * segmentSize` with `pwrite()`, therefore every segment
+   * except the last one must contain exactly @p segmentSize octets, as created by Segmenter.
+   * The file is extended as needed, and segments may be written in any order.
+   *
+   * @param fd File descriptor open for writing, which is not closed by the sink.
+   * @param segmentSize Size of the payload of each segment except the last one.
+   */
+  static Options::Sink
+  makeFileSink(int fd, size_t segmentSize);
+
+  /**
+   * @brief Returns a sink that copies each segment into a memory region, at the offset of the segment.
+   *
+   * This is suitable for a region obtained with `mmap()`. Every segment except the last one must
+   * contain exactly @p segmentSize octets. A segment that does not fit in @p region is an error.
+   *
+   * @param region Destination memory, which must remain valid until the retrieval ends.
+   * @param segmentSize Size of the payload of each segment except the last one.
+   */
+  static Options::Sink
+  makeMemorySink(span<uint8_t> region, size_t segmentSize);
+
 private:
   class PendingSegment;
+  class SharedWindow;
+
+  SegmentFetcher(Face& face, security::Validator& validator, const Options& options,
+                 shared_ptr<SharedWindow> sharedWindow = nullptr);
+
+  /**
+   * @brief Initiates segment fetching with a congestion window shared with other fetchers.
+   */
+  static shared_ptr<SegmentFetcher>
+  start(Face& face, const Interest& baseInterest, security::Validator& validator,
+        const Options& options, const shared_ptr<SharedWindow>& sharedWindow);
 
-  SegmentFetcher(Face& face, security::Validator& validator, const Options& options);
+  static shared_ptr<SharedWindow>
+  makeSharedWindow(const Options& options);
 
   static bool
   shouldStop(const weak_ptr<SegmentFetcher>& weakSelf);
@@ -194,6 +264,28 @@ private:
   void
   fetchSegmentsInWindow(const Interest& origInterest);
 
+  /**
+   * @brief Returns the next segment to request, and whether it is a retransmission.
+   */
+  std::optional<std::pair<uint64_t, bool>>
+  getNextSegmentToRequest();
+
+  /**
+   * @brief Returns the number of received segments that count against Options::flowControlWindow.
+   */
+  size_t
+  getNBufferedSegments() const;
+
+  /**
+   * @brief Sends an Interest for the next segment, if any, on behalf of the shared window.
+   * @return whether an Interest has been sent
+   */
+  bool
+  sendNextSegment();
+
+  void
+  sendSegmentInterest(const Interest& origInterest, uint64_t segNum, bool isRetransmission);
+
   void
   sendInterest(uint64_t segNum, const Interest& interest, bool isRetransmission);
 
@@ -201,15 +293,23 @@ private:
   afterSegmentReceivedCb(const Interest& origInterest, const Data& data,
                          const weak_ptr<SegmentFetcher>& weakSelf);
 
+  /**
+   * @brief Updates the window and the RTT estimator upon receipt of a segment.
+   */
   void
-  afterValidationSuccess(const Data& data, const Interest& origInterest,
-                         std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt,
-                         const weak_ptr<SegmentFetcher>& weakSelf);
+  acceptSegment(const Data& data, std::map<uint64_t, PendingSegment>::iterator pendingSegmentIt);
 
+  /**
+   * @brief Stores or delivers a segment that has been validated.
+   */
   void
-  afterValidationFailure(const Data& data,
-                         const security::ValidationError& error,
-                         const weak_ptr<SegmentFetcher>& weakSelf);
+  consumeSegment(const Data& data, const Interest& origInterest);
+
+  /**
+   * @brief Applies the validation results that are available, in the order of receipt.
+   */
+  void
+  applyValidationResults();
 
   void
   afterNackReceivedCb(const Interest& origInterest, const lp::Nack& nack,
@@ -231,13 +331,21 @@ private:
   void
   windowDecrease();
 
+  static void
+  increaseWindow(const Options& options, double& cwnd, double ssthresh);
+
+  static void
+  decreaseWindow(const Options& options, double& cwnd, double& ssthresh,
+                 uint64_t highInterest, uint64_t highData, uint64_t& recPoint);
+
   void
   signalError(uint32_t code, const std::string& msg);
 
   void
   updateRetransmittedSegment(uint64_t segmentNum,
                              const PendingInterestHandle& pendingInterest,
-                             scheduler::EventId timeoutEvent);
+                             scheduler::EventId timeoutEvent,
+                             uint64_t windowSeq);
 
   void
   cancelExcessInFlightSegments();
@@ -245,6 +353,9 @@ private:
   bool
   checkAllSegmentsReceived();
 
+  util::RttEstimator&
+  getRttEstimator();
+
   time::milliseconds
   getEstimatedRto();
 
@@ -294,6 +405,12 @@ public:
    */
   signal::Signal<SegmentFetcher> onInOrderComplete;
 
+  /**
+   * @brief Emitted on successful retrieval of all segments in 'sink' mode.
+   * @note Emitted only if SegmentFetcher is operating in 'sink' mode.
+   */
+  signal::Signal<SegmentFetcher> onSinkComplete;
+
 private:
   enum class SegmentState {
     FirstInterest, ///< the first Interest for this segment has been sent
@@ -308,6 +425,16 @@ private:
     time::steady_clock::time_point sendTime;
     ScopedPendingInterestHandle hdl;
     scheduler::ScopedEventId timeoutEvent;
+    uint64_t windowSeq; ///< sequence number of the last Interest in the shared window
+  };
+
+  /// A received segment whose validation result has not been applied yet
+  struct PendingValidation
+  {
+    Data data;
+    Interest origInterest;
+    bool isDone = false;
+    std::optional<security::ValidationError> error; ///< set if the validation failed
   };
 
 NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -336,9 +463,16 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   int64_t m_nBytesReceived = 0;
   uint64_t m_nextSegmentInOrder = 0;
 
-  std::map<uint64_t, Buffer> m_segmentBuffer;
+  std::map<uint64_t, Buffer> m_segmentBuffer; ///< unused in 'sink' mode
   std::map<uint64_t, PendingSegment> m_pendingSegments;
   std::set<uint64_t> m_receivedSegments;
+
+  std::deque<shared_ptr<PendingValidation>> m_pendingValidations; ///< in order of receipt
+
+  shared_ptr<SharedWindow> m_sharedWindow; ///< nullptr unless started by SegmentFetchManager
+  std::optional<Interest> m_interestTemplate; ///< base of the Interests sent for the shared window
+
+  friend class SegmentFetchManager;
 };
 
 } // namespace ndn
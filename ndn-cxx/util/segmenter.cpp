@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -21,48 +21,39 @@
 
 #include "ndn-cxx/util/segmenter.hpp"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/iostreams/read.hpp>
 
+#include <deque>
+#include <future>
+
 namespace ndn {
 
-Segmenter::Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo)
+Segmenter::Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+                     size_t nSigningThreads)
   : m_keyChain(keyChain)
   , m_signingInfo(signingInfo)
+  , m_nSigningThreads(nSigningThreads)
 {
+  if (m_nSigningThreads > 0) {
+    m_signingPool = make_unique<boost::asio::thread_pool>(m_nSigningThreads);
+  }
 }
 
+Segmenter::~Segmenter() = default;
+
 std::vector<std::shared_ptr<Data>>
 Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
                    time::milliseconds freshnessPeriod, uint32_t contentType)
 {
-  if (maxSegmentSize == 0) {
-    NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
-  }
-
-  // minimum of one (possibly empty) segment
-  const uint64_t numSegments = 1 + (buffer.size() - !buffer.empty()) / maxSegmentSize;
-  const auto finalBlockId = name::Component::fromSegment(numSegments - 1);
-
   std::vector<std::shared_ptr<Data>> segments;
-  segments.reserve(numSegments);
-
-  do {
-    auto segLen = std::min(buffer.size(), maxSegmentSize);
-
-    auto data = std::make_shared<Data>();
-    data->setName(Name(dataName).appendSegment(segments.size()));
-    data->setContentType(contentType);
-    data->setFreshnessPeriod(freshnessPeriod);
-    data->setFinalBlock(finalBlockId);
-    data->setContent(buffer.first(segLen));
-
-    m_keyChain.sign(*data, m_signingInfo);
-    segments.push_back(std::move(data));
-
-    buffer = buffer.subspan(segLen);
-  } while (!buffer.empty());
-
-  BOOST_ASSERT(segments.size() == numSegments);
+  if (maxSegmentSize > 0) {
+    segments.reserve(1 + (buffer.size() - !buffer.empty()) / maxSegmentSize);
+  }
+  segment(buffer, dataName, maxSegmentSize, freshnessPeriod,
+          [&] (auto data) { segments.push_back(std::move(data)); },
+          contentType);
   return segments;
 }
 
@@ -106,10 +97,186 @@ Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentS
   const auto finalBlockId = name::Component::fromSegment(segments.size() - 1);
   for (const auto& data : segments) {
     data->setFinalBlock(finalBlockId);
-    m_keyChain.sign(*data, m_signingInfo);
   }
+  size_t i = 0;
+  signSegments([&] { return i < segments.size() ? segments[i++] : nullptr; },
+               [] (auto&&) {});
 
   return segments;
 }
 
+uint64_t
+Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxSegmentSize,
+                   time::milliseconds freshnessPeriod, const SegmentCallback& onSegment,
+                   uint32_t contentType)
+{
+  if (maxSegmentSize == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
+  }
+
+  // minimum of one (possibly empty) segment
+  const uint64_t numSegments = 1 + (buffer.size() - !buffer.empty()) / maxSegmentSize;
+  const auto finalBlockId = name::Component::fromSegment(numSegments - 1);
+
+  uint64_t segNo = 0;
+  auto n = signSegments([&] () -> std::shared_ptr<Data> {
+    if (segNo == numSegments) {
+      return nullptr;
+    }
+    auto segLen = std::min(buffer.size(), maxSegmentSize);
+
+    auto data = std::make_shared<Data>();
+    data->setName(Name(dataName).appendSegment(segNo++));
+    data->setContentType(contentType);
+    data->setFreshnessPeriod(freshnessPeriod);
+    data->setFinalBlock(finalBlockId);
+    data->setContent(buffer.first(segLen));
+
+    buffer = buffer.subspan(segLen);
+    return data;
+  }, onSegment);
+
+  BOOST_ASSERT(n == numSegments);
+  return n;
+}
+
+uint64_t
+Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentSize,
+                   time::milliseconds freshnessPeriod, const SegmentCallback& onSegment,
+                   uint32_t contentType)
+{
+  if (maxSegmentSize == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
+  }
+
+  // Returns the next chunk of input, or nullptr on EOF.
+  auto readChunk = [&] () -> std::shared_ptr<Buffer> {
+    auto buffer = std::make_shared<Buffer>(maxSegmentSize);
+    auto n = boost::iostreams::read(input, buffer->get<char>(), buffer->size());
+    if (n < 0) { // EOF
+      return nullptr;
+    }
+    buffer->resize(n);
+    return buffer;
+  };
+
+  // read one chunk ahead, in order to know which segment is the last one
+  auto nextChunk = readChunk();
+  uint64_t segNo = 0;
+  bool isDone = false;
+  return signSegments([&] () -> std::shared_ptr<Data> {
+    if (isDone) {
+      return nullptr;
+    }
+
+    auto data = std::make_shared<Data>();
+    data->setName(Name(dataName).appendSegment(segNo));
+    data->setContentType(contentType);
+    data->setFreshnessPeriod(freshnessPeriod);
+    // if the input is empty, a single empty segment is created
+    if (nextChunk != nullptr) {
+      data->setContent(std::move(nextChunk));
+      nextChunk = readChunk();
+    }
+    if (nextChunk == nullptr) {
+      data->setFinalBlock(name::Component::fromSegment(segNo));
+      isDone = true;
+    }
+    ++segNo;
+    return data;
+  }, onSegment);
+}
+
+uint64_t
+Segmenter::signSegments(const std::function<std::shared_ptr<Data>()>& nextSegment,
+                        const SegmentCallback& onSegment)
+{
+  using Batch = std::vector<std::shared_ptr<Data>>;
+
+  const auto ctx = m_keyChain.prepareSigningContext(m_signingInfo);
+  const KeyChain& keyChain = m_keyChain;
+  const size_t batchSize = m_batchSize;
+
+  auto nextBatch = [&] {
+    Batch batch;
+    while (batch.size() < std::max<size_t>(batchSize, 1)) {
+      auto data = nextSegment();
+      if (data == nullptr) {
+        break;
+      }
+      batch.push_back(std::move(data));
+    }
+    return batch;
+  };
+
+  // may be invoked on a worker thread
+  auto signBatch = [&keyChain, &ctx, batchSize] (const Batch& batch) {
+    if (batchSize <= 1) {
+      keyChain.sign(*batch.front(), ctx);
+      return;
+    }
+    std::vector<Data*> packets;
+    packets.reserve(batch.size());
+    for (const auto& data : batch) {
+      packets.push_back(data.get());
+    }
+    keyChain.signBatch(packets, ctx);
+  };
+
+  uint64_t nSegments = 0;
+  auto deliverBatch = [&] (Batch&& batch) {
+    for (auto& data : batch) {
+      onSegment(std::move(data));
+      ++nSegments;
+    }
+  };
+
+  if (m_signingPool == nullptr) {
+    for (auto batch = nextBatch(); !batch.empty(); batch = nextBatch()) {
+      signBatch(batch);
+      deliverBatch(std::move(batch));
+    }
+    return nSegments;
+  }
+
+  // Keep a few batches per thread in flight: enough to keep all threads busy while the
+  // calling thread reads the input and consumes the signed packets, but bounded in memory.
+  const size_t maxInFlight = 4 * m_nSigningThreads;
+  std::deque<std::future<Batch>> inFlight;
+
+  try {
+    bool hasMore = true;
+    while (hasMore || !inFlight.empty()) {
+      while (hasMore && inFlight.size() < maxInFlight) {
+        auto batch = nextBatch();
+        if (batch.empty()) {
+          hasMore = false;
+          break;
+        }
+        std::packaged_task<Batch()> task([signBatch, batch = std::move(batch)] {
+          signBatch(batch);
+          return batch;
+        });
+        inFlight.push_back(task.get_future());
+        boost::asio::post(*m_signingPool, std::move(task));
+      }
+
+      if (!inFlight.empty()) {
+        auto signedBatch = std::move(inFlight.front());
+        inFlight.pop_front();
+        deliverBatch(signedBatch.get());
+      }
+    }
+  }
+  catch (...) {
+    // the pending tasks refer to the signing context, which is about to be destroyed
+    for (const auto& f : inFlight) {
+      f.wait();
+    }
+    throw;
+  }
+
+  return nSegments;
+}
+
 } // namespace ndn
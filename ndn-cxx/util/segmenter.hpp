@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -22,6 +22,7 @@
 #ifndef NDN_CXX_UTIL_SEGMENTER_HPP
 #define NDN_CXX_UTIL_SEGMENTER_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/util/span.hpp"
 
@@ -30,15 +31,42 @@ namespace ndn {
 /**
  * @brief Utility class to segment an object into multiple Data packets.
  */
-class Segmenter
+class Segmenter : noncopyable
 {
 public:
+  /**
+   * @brief Callback invoked with each created Data packet, in order of segment number.
+   */
+  using SegmentCallback = std::function<void(std::shared_ptr<Data>)>;
+
   /**
    * @brief Constructor.
    * @param keyChain KeyChain instance used for signing the packets.
    * @param signingInfo How to sign the packets.
+   * @param nSigningThreads Number of worker threads used for signing the packets.
+   *                        If zero, the packets are signed on the calling thread.
+   *
+   * The signing threads do not access @p keyChain: they sign with the private key that
+   * segment() obtains from KeyChain::prepareSigningContext() on the calling thread.
+   */
+  Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo,
+            size_t nSigningThreads = 0);
+
+  ~Segmenter();
+
+  /**
+   * @brief Enable or disable batch signing.
+   * @param batchSize Number of consecutive segments that are signed together with a single
+   *                  signature using KeyChain::signBatch(). If zero or one, each segment is
+   *                  signed individually, which is the default.
+   *
+   * With batch signing, each signing thread keeps up to a few batches in memory.
    */
-  Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo);
+  void
+  setSigningBatchSize(size_t batchSize)
+  {
+    m_batchSize = batchSize;
+  }
 
   /**
    * @brief Splits a blob of bytes into one or more Data packets (segments).
@@ -72,9 +100,66 @@ public:
           time::milliseconds freshnessPeriod,
           uint32_t contentType = tlv::ContentType_Blob);
 
+  /**
+   * @brief Splits a blob of bytes into one or more Data packets, passing each of them to a callback.
+   * @param buffer Contiguous range of bytes to divide into segments.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param onSegment Callback invoked on the calling thread with each signed Data packet.
+   * @param contentType The `ContentType` of created Data packets.
+   * @return The number of created Data packets.
+   * @note A minimum of one Data packet is always created, even if @p buffer is empty.
+   */
+  uint64_t
+  segment(span<const uint8_t> buffer,
+          const Name& dataName,
+          size_t maxSegmentSize,
+          time::milliseconds freshnessPeriod,
+          const SegmentCallback& onSegment,
+          uint32_t contentType = tlv::ContentType_Blob);
+
+  /**
+   * @brief Creates one or more Data packets with the bytes read from an input stream, passing each
+   *        of them to a callback as soon as it is signed.
+   * @param input The input stream. Reading stops when EOF is encountered.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param onSegment Callback invoked on the calling thread with each signed Data packet.
+   * @param contentType The `ContentType` of created Data packets.
+   * @return The number of created Data packets.
+   *
+   * The input is read one segment at a time, and at most a few segments per signing thread are
+   * kept in memory, so that arbitrarily large inputs can be published with bounded memory.
+   * The `FinalBlockId` is set only on the last Data packet, because the number of segments is
+   * not known in advance.
+   *
+   * @note A minimum of one Data packet is always created, even if @p input is empty.
+   */
+  uint64_t
+  segment(std::istream& input,
+          const Name& dataName,
+          size_t maxSegmentSize,
+          time::milliseconds freshnessPeriod,
+          const SegmentCallback& onSegment,
+          uint32_t contentType = tlv::ContentType_Blob);
+
+private:
+  /**
+   * @brief Signs the packets returned by @p nextSegment until it returns nullptr, and passes
+   *        them to @p onSegment in the same order.
+   */
+  uint64_t
+  signSegments(const std::function<std::shared_ptr<Data>()>& nextSegment,
+               const SegmentCallback& onSegment);
+
 private:
   KeyChain& m_keyChain;
   security::SigningInfo m_signingInfo;
+  size_t m_nSigningThreads;
+  size_t m_batchSize = 0;
+  unique_ptr<boost::asio::thread_pool> m_signingPool;
 };
 
 } // namespace ndn
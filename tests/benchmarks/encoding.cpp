@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -22,7 +22,11 @@
 #define BOOST_TEST_MODULE ndn-cxx Encoding Benchmark
 #include "tests/boost-test.hpp"
 
+#include "ndn-cxx/data.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/lp/fields.hpp"
+#include "ndn-cxx/lp/packet.hpp"
 #include "tests/benchmarks/timed-execute.hpp"
 
 #include <boost/mp11/list.hpp>
@@ -119,4 +123,223 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
             << " " << d << std::endl;
 }
 
+static std::vector<Name>
+makeNames(size_t n)
+{
+  std::vector<Name> names;
+  names.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    names.push_back(Name("/benchmark/encoding/producer").appendVersion(1).appendSegment(i));
+  }
+  return names;
+}
+
+// Benchmark of Data::wireEncode, re-encoding a signed Data packet after each change of its name.
+BOOST_AUTO_TEST_CASE(DataEncode)
+{
+  constexpr int N_ITERATIONS = 2000000;
+  const auto names = makeNames(100);
+
+  Data data;
+  data.setFreshnessPeriod(10_s);
+  data.setContent(std::vector<uint8_t>(1000, 0xAB));
+  SignatureInfo sigInfo(tlv::SignatureSha256WithEcdsa, KeyLocator(Name("/benchmark/KEY/%01")));
+  data.setSignatureInfo(sigInfo);
+  data.setSignatureValue(std::make_shared<Buffer>(72));
+
+  size_t nBytes = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      data.setName(names[i % names.size()]);
+      nBytes += data.wireEncode().size();
+    }
+  });
+  BOOST_CHECK_GT(nBytes, 0);
+  std::cout << "Data " << N_ITERATIONS << " encodings: " << d << std::endl;
+}
+
+// Benchmark of Interest::wireEncode, re-encoding an Interest after each change of its name.
+BOOST_AUTO_TEST_CASE(InterestEncode)
+{
+  constexpr int N_ITERATIONS = 2000000;
+  const auto names = makeNames(100);
+
+  Interest interest;
+  interest.setCanBePrefix(true);
+  interest.setMustBeFresh(true);
+  interest.setInterestLifetime(2_s);
+  interest.setHopLimit(64);
+  interest.setNonce(0x12345678);
+
+  size_t nBytes = 0;
+  auto d = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      interest.setName(names[i % names.size()]);
+      nBytes += interest.wireEncode().size();
+    }
+  });
+  BOOST_CHECK_GT(nBytes, 0);
+  std::cout << "Interest " << N_ITERATIONS << " encodings: " << d << std::endl;
+}
+
+// Benchmark of Data decoding: eager wireDecode, wireDecodeLazy, and peekName,
+// each followed by reading the name, as a forwarder or cache would do.
+BOOST_AUTO_TEST_CASE(DataDecode)
+{
+  constexpr int N_ITERATIONS = 2000000;
+
+  Data data(makeNames(1).front());
+  data.setFreshnessPeriod(10_s);
+  data.setContent(std::vector<uint8_t>(1000, 0xAB));
+  data.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                      KeyLocator(Name("/benchmark/KEY/%01"))));
+  data.setSignatureValue(std::make_shared<Buffer>(72));
+  const Block wire = data.wireEncode();
+
+  size_t nComponents = 0;
+  auto eager = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Data decoded;
+      decoded.wireDecode(wire);
+      nComponents += decoded.getName().size();
+    }
+  });
+  auto lazy = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Data decoded;
+      decoded.wireDecodeLazy(wire);
+      nComponents += decoded.getName().size();
+    }
+  });
+  size_t nBytes = 0;
+  auto peek = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      nBytes += Data::peekName(wire).size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nComponents, 2 * N_ITERATIONS * data.getName().size());
+  BOOST_CHECK_EQUAL(nBytes, N_ITERATIONS * data.getName().wireEncode().size());
+  std::cout << "Data " << N_ITERATIONS << " decodings: eager=" << eager
+            << " lazy=" << lazy << " peekName=" << peek << std::endl;
+}
+
+// Benchmark of Interest decoding: eager wireDecode, wireDecodeLazy, and peekName,
+// each followed by reading the name.
+BOOST_AUTO_TEST_CASE(InterestDecode)
+{
+  constexpr int N_ITERATIONS = 2000000;
+
+  Interest interest(makeNames(1).front());
+  interest.setCanBePrefix(true);
+  interest.setForwardingHint({"/benchmark/hint/A", "/benchmark/hint/B"});
+  interest.setNonce(0x12345678);
+  interest.setApplicationParameters(std::vector<uint8_t>(100, 0xCD));
+  const Block wire = interest.wireEncode();
+
+  size_t nComponents = 0;
+  auto eager = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Interest decoded;
+      decoded.wireDecode(wire);
+      nComponents += decoded.getName().size();
+    }
+  });
+  auto lazy = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Interest decoded;
+      decoded.wireDecodeLazy(wire);
+      nComponents += decoded.getName().size();
+    }
+  });
+  size_t nBytes = 0;
+  auto peek = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      nBytes += Interest::peekName(wire).size();
+    }
+  });
+  BOOST_CHECK_EQUAL(nComponents, 2 * N_ITERATIONS * interest.getName().size());
+  BOOST_CHECK_EQUAL(nBytes, N_ITERATIONS * interest.getName().wireEncode().size());
+  std::cout << "Interest " << N_ITERATIONS << " decodings: eager=" << eager
+            << " lazy=" << lazy << " peekName=" << peek << std::endl;
+}
+
+// Benchmark of the references to the packet buffer made by the decoders of Data, Interest, and
+// LpPacket. The decoders walk the encoding with BlockView, and create a Block, which holds a
+// reference to the buffer, only for the fields that the packet retains. The encoding is parsed
+// into sub-elements, one reference each, only when wireEncode() is called or, for LpPacket, when
+// the packet is modified. Every reference costs an atomic increment when it is created and an
+// atomic decrement when it is released; the number of references held by a decoded packet is
+// reported before and after it is used as indicated.
+template<typename Packet, typename Use>
+static void
+decodeAndUse(const std::string& label, const Block& wire, const std::string& useLabel, const Use& use)
+{
+  constexpr int N_ITERATIONS = 1000000;
+  const long nBaseRefs = wire.getBuffer().use_count();
+
+  long nDecodedRefs = 0;
+  auto decode = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Packet decoded;
+      decoded.wireDecode(wire);
+      nDecodedRefs = wire.getBuffer().use_count() - nBaseRefs;
+    }
+  });
+  long nUsedRefs = 0;
+  auto decodeAndUse = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      Packet decoded;
+      decoded.wireDecode(wire);
+      use(decoded);
+      nUsedRefs = wire.getBuffer().use_count() - nBaseRefs;
+    }
+  });
+  BOOST_CHECK_EQUAL(wire.getBuffer().use_count(), nBaseRefs);
+  std::cout << label << " " << N_ITERATIONS << " decodings: " << decode
+            << " (" << nDecodedRefs << " references to the buffer); with " << useLabel << ": "
+            << decodeAndUse << " (" << nUsedRefs << " references)" << std::endl;
+}
+
+static Block
+copyToNewBuffer(const Block& block)
+{
+  // the copy is not parsed, so the decoders are the only ones that reference its buffer
+  return Block(std::make_shared<const Buffer>(block.begin(), block.end()));
+}
+
+BOOST_AUTO_TEST_CASE(DecodeReferences)
+{
+  Data data(makeNames(1).front());
+  data.setFreshnessPeriod(10_s);
+  data.setContent(std::vector<uint8_t>(1000, 0xAB));
+  data.setSignatureInfo(SignatureInfo(tlv::SignatureSha256WithEcdsa,
+                                      KeyLocator(Name("/benchmark/KEY/%01"))));
+  data.setSignatureValue(std::make_shared<Buffer>(72));
+  const Block dataWire = copyToNewBuffer(data.wireEncode());
+  decodeAndUse<Data>("Data", dataWire, "wireEncode()", [] (const Data& d) { d.wireEncode(); });
+
+  Interest interest(makeNames(1).front());
+  interest.setCanBePrefix(true);
+  interest.setForwardingHint({"/benchmark/hint/A", "/benchmark/hint/B"});
+  interest.setNonce(0x12345678);
+  interest.setApplicationParameters(std::vector<uint8_t>(100, 0xCD));
+  const Block interestWire = copyToNewBuffer(interest.wireEncode());
+  decodeAndUse<Interest>("Interest", interestWire, "wireEncode()",
+                         [] (const Interest& i) { i.wireEncode(); });
+
+  lp::Packet lpPacket;
+  lpPacket.add<lp::FragmentField>({dataWire.begin(), dataWire.end()});
+  const Buffer pitToken(8, 0x01);
+  lpPacket.add<lp::PitTokenField>({pitToken.begin(), pitToken.end()});
+  lpPacket.add<lp::CongestionMarkField>(1);
+  const Block lpWire = copyToNewBuffer(lpPacket.wireEncode());
+  decodeAndUse<lp::Packet>("LpPacket", lpWire, "reading the fields as Face does",
+                           [] (const lp::Packet& p) {
+                             BOOST_CHECK(!p.has<lp::NackField>());
+                             BOOST_CHECK_EQUAL(p.get<lp::CongestionMarkField>(), 1);
+                             auto [begin, end] = p.get<lp::FragmentField>();
+                             BOOST_CHECK(begin != end);
+                           });
+}
+
 } // namespace ndn::tests
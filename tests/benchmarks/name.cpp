@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Name Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/name.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn::tests {
+
+const size_t NAME_LENGTHS[] = {1, 4, 8, 16, 32};
+
+// Return two names of nComponents components that differ only in the last byte,
+// so that comparing them has to go through the whole encoding.
+static std::pair<Name, Name>
+makeNamePair(size_t nComponents)
+{
+  Name a, b;
+  for (size_t i = 0; i + 1 < nComponents; ++i) {
+    std::string comp = "component-" + std::to_string(i);
+    a.append(comp);
+    b.append(comp);
+  }
+  a.append("last-component-A");
+  b.append("last-component-B");
+  return {a, b};
+}
+
+// Benchmark of Name::compare, operator==, and isPrefixOf on names that differ only at the end.
+BOOST_AUTO_TEST_CASE(Compare)
+{
+  constexpr int N_ITERATIONS = 5000000;
+
+  for (size_t nComponents : NAME_LENGTHS) {
+    auto [a, b] = makeNamePair(nComponents);
+    const Name aCopy = a;
+    const Name prefix = a.getPrefix(-1);
+
+    int nLess = 0;
+    auto compare = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        nLess += a.compare(b) < 0;
+      }
+    });
+    int nEqual = 0;
+    auto equal = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        nEqual += a == aCopy;
+      }
+    });
+    int nPrefix = 0;
+    auto isPrefix = timedExecute([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        nPrefix += prefix.isPrefixOf(b);
+      }
+    });
+    BOOST_CHECK_EQUAL(nLess, N_ITERATIONS);
+    BOOST_CHECK_EQUAL(nEqual, N_ITERATIONS);
+    BOOST_CHECK_EQUAL(nPrefix, N_ITERATIONS);
+
+    std::cout << nComponents << " components (" << a.wireEncode().value_size() << " octets), "
+              << N_ITERATIONS << " iterations: compare=" << compare << " equal=" << equal
+              << " isPrefixOf=" << isPrefix << std::endl;
+  }
+}
+
+// Benchmark of Name hashing. The hash values are computed on the first getHash call after the
+// name is decoded, so both are measured; subsequent calls only read the cached result.
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  constexpr size_t N_NAMES = 100000;
+  constexpr int N_ROUNDS = 20;
+
+  for (size_t nComponents : NAME_LENGTHS) {
+    const Block wire = makeNamePair(nComponents).first.wireEncode();
+
+    size_t sum = 0;
+    time::nanoseconds decode = 0_ns;
+    time::nanoseconds hash = 0_ns;
+    std::vector<Name> names;
+    for (int round = 0; round < N_ROUNDS; ++round) {
+      names.assign(N_NAMES, Name());
+      decode += timedExecute([&] {
+        for (auto& name : names) {
+          name.wireDecode(wire);
+        }
+      });
+      hash += timedExecute([&] {
+        for (const auto& name : names) {
+          sum += name.getHash();
+        }
+      });
+    }
+    BOOST_CHECK_NE(sum, 0);
+
+    std::cout << nComponents << " components, " << N_NAMES * N_ROUNDS << " names: wireDecode="
+              << decode << " getHash=" << hash << std::endl;
+  }
+}
+
+} // namespace ndn::tests
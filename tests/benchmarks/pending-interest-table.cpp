@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Pending Interest Table Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <iostream>
+
+namespace ndn::tests {
+
+// Benchmark of Data matching against the pending Interest table of a Face.
+// The time per Data should stay roughly constant as the number of pending Interests grows.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(SatisfyPendingInterests)
+{
+  constexpr size_t N_DATA = 1000;
+  const Name prefix("/localhost/benchmark/pit");
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+
+  for (size_t pitSize : {1000, 10000, 50000}) {
+    boost::asio::io_context io;
+    DummyClientFace face(io, keyChain, {false, false});
+
+    for (size_t i = 0; i < pitSize; ++i) {
+      Interest interest(Name(prefix).appendSequenceNumber(i));
+      interest.setCanBePrefix(i % 2 == 0);
+      interest.setInterestLifetime(1_h);
+      face.expressInterest(interest, nullptr, nullptr, nullptr);
+    }
+    io.poll();
+    BOOST_REQUIRE_EQUAL(face.getNPendingInterests(), pitSize);
+
+    std::vector<Data> data;
+    data.reserve(N_DATA);
+    for (size_t i = 0; i < N_DATA; ++i) {
+      data.emplace_back(Name(prefix).appendSequenceNumber(i * pitSize / N_DATA));
+      data.back().setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+      data.back().setSignatureValue(std::make_shared<Buffer>(32));
+      data.back().wireEncode();
+    }
+
+    auto d = timedExecute([&] {
+      for (const auto& datum : data) {
+        face.receive(datum);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(face.getNPendingInterests(), pitSize - N_DATA);
+    std::cout << "PIT size " << pitSize << ": " << N_DATA << " Data in " << d
+              << " (" << d / static_cast<int>(N_DATA) << " per Data)" << std::endl;
+  }
+}
+
+} // namespace ndn::tests
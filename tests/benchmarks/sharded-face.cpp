@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Sharded Face Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/sharded-face.hpp"
+#include "ndn-cxx/transport/transport.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+#include <iostream>
+#include <thread>
+
+namespace ndn::tests {
+
+/**
+ * \brief Transport that injects a fixed set of Interests, and counts the Data sent in reply.
+ */
+class InjectingTransport final : public ndn::Transport
+{
+public:
+  InjectingTransport(std::vector<Block> interests, std::function<void()> onAllReplied)
+    : m_interests(std::move(interests))
+    , m_onAllReplied(std::move(onAllReplied))
+  {
+  }
+
+  void
+  connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback) final
+  {
+    Transport::connect(ioCtx, std::move(receiveCallback));
+    setState(State::RUNNING);
+    boost::asio::post(ioCtx, [this] { injectMore(); });
+  }
+
+  void
+  close() final
+  {
+    setState(State::CLOSED);
+  }
+
+  void
+  pause() final
+  {
+  }
+
+  void
+  resume() final
+  {
+  }
+
+  void
+  send(const Block&) final
+  {
+    if (++m_nReplies == m_interests.size()) {
+      m_onAllReplied();
+    }
+  }
+
+private:
+  void
+  injectMore()
+  {
+    // emulate reading from a socket: a bounded batch of Interests per I/O loop iteration
+    size_t end = std::min(m_nInjected + 64, m_interests.size());
+    for (; m_nInjected < end; ++m_nInjected) {
+      m_receiveCallback(m_interests[m_nInjected]);
+    }
+    if (m_nInjected < m_interests.size()) {
+      boost::asio::post(*m_ioCtx, [this] { injectMore(); });
+    }
+  }
+
+private:
+  std::vector<Block> m_interests;
+  std::function<void()> m_onAllReplied;
+  size_t m_nInjected = 0;
+  size_t m_nReplies = 0;
+};
+
+// Benchmark of a producer that signs every Data packet with ECDSA, which is the dominant cost
+// per Interest. Throughput is expected to scale with the number of shards, up to the number of
+// available cores. For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(SigningProducer)
+{
+  constexpr size_t N_INTERESTS = 20000;
+  const size_t nCores = std::max(1U, std::thread::hardware_concurrency());
+
+  std::vector<Block> interests;
+  interests.reserve(N_INTERESTS);
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    Interest interest(Name("/localhost/benchmark/sharded").appendSequenceNumber(i));
+    interest.setNonce(Interest::Nonce{0x01, 0x02, 0x03, 0x04});
+    interests.push_back(interest.wireEncode());
+  }
+
+  std::cout << "Available cores: " << nCores << std::endl;
+  for (size_t nShards = 1; nShards <= std::max<size_t>(4, nCores); nShards *= 2) {
+    KeyChain ioKeyChain("pib-memory:", "tpm-memory:");
+    // KeyChain is not thread-safe, therefore each shard signs with its own KeyChain
+    std::vector<unique_ptr<KeyChain>> shardKeyChains;
+    for (size_t i = 0; i < nShards; ++i) {
+      auto& keyChain = *shardKeyChains.emplace_back(make_unique<KeyChain>("pib-memory:", "tpm-memory:"));
+      keyChain.createIdentity(Name("/localhost/benchmark/shard").appendNumber(i));
+    }
+
+    ShardedFace* facePtr = nullptr;
+    auto transport = make_shared<InjectingTransport>(interests, [&] { facePtr->shutdown(); });
+    ShardedFace face(transport, ioKeyChain, nShards);
+    facePtr = &face;
+
+    face.setInterestFilter("/localhost/benchmark/sharded",
+      [&] (Face& shard, const InterestFilter&, const Interest& interest) {
+        size_t shardIndex = face.getShardIndex(interest.getName());
+        Data data(interest.getName());
+        data.setFreshnessPeriod(1_s);
+        data.setContent(std::vector<uint8_t>(1000, 0xAB));
+        shardKeyChains[shardIndex]->sign(data);
+        shard.put(data);
+      });
+
+    auto d = timedExecute([&] { face.run(); });
+    std::cout << nShards << " shard(s): " << N_INTERESTS << " Interests in " << d << ", "
+              << static_cast<uint64_t>(N_INTERESTS * 1e9 / d.count()) << " Interests/s" << std::endl;
+  }
+}
+
+} // namespace ndn::tests
@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Stream Transport Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/transport/tcp-transport.hpp"
+#include "ndn-cxx/transport/unix-transport.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/mp11/list.hpp>
+
+#include <array>
+#include <filesystem>
+#include <iostream>
+
+namespace ndn::tests {
+
+struct UnixTransportTest
+{
+  using Protocol = boost::asio::local::stream_protocol;
+
+  static Protocol::endpoint
+  makeEndpoint()
+  {
+    auto path = std::filesystem::temp_directory_path() / "ndn-cxx-bench-stream-transport.sock";
+    std::filesystem::remove(path);
+    return Protocol::endpoint(path.string());
+  }
+
+  static shared_ptr<Transport>
+  makeTransport(const Protocol::endpoint& ep)
+  {
+    return make_shared<UnixTransport>(ep.path());
+  }
+};
+
+struct TcpTransportTest
+{
+  using Protocol = boost::asio::ip::tcp;
+
+  static Protocol::endpoint
+  makeEndpoint()
+  {
+    return Protocol::endpoint(boost::asio::ip::address_v4::loopback(), 0);
+  }
+
+  static shared_ptr<Transport>
+  makeTransport(const Protocol::endpoint& ep)
+  {
+    return make_shared<TcpTransport>(ep.address().to_string(), std::to_string(ep.port()));
+  }
+};
+
+using StreamTransportTests = boost::mp11::mp_list<UnixTransportTest, TcpTransportTest>;
+
+// Benchmark of sending a burst of Interests through a stream transport to a local peer.
+// Queued Interests are coalesced into gathering writes, so the number of write system calls
+// is much smaller than the number of Interests.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(SendBurst, Test, StreamTransportTests)
+{
+  constexpr int N_INTERESTS = 200000;
+
+  boost::asio::io_context io;
+  typename Test::Protocol::acceptor acceptor(io, Test::makeEndpoint());
+  typename Test::Protocol::socket peer(io);
+  acceptor.async_accept(peer, [] (const auto& error) { BOOST_REQUIRE(!error); });
+
+  auto transport = Test::makeTransport(acceptor.local_endpoint());
+  transport->connect(io, [] (auto&&) {});
+  while (!peer.is_open() || transport->getState() == Transport::State::CONNECTING) {
+    io.run_one();
+  }
+
+  std::vector<Block> wires;
+  wires.reserve(N_INTERESTS);
+  size_t nTotalBytes = 0;
+  for (int i = 0; i < N_INTERESTS; ++i) {
+    Interest interest(Name("/localhost/benchmark/transport").appendSequenceNumber(i));
+    interest.setNonce(Interest::Nonce{0x01, 0x02, 0x03, 0x04});
+    wires.push_back(interest.wireEncode());
+    nTotalBytes += wires.back().size();
+  }
+
+  size_t nReceivedBytes = 0;
+  size_t nReads = 0;
+  std::array<uint8_t, 65536> rxBuffer;
+  std::function<void()> readMore = [&] {
+    peer.async_read_some(boost::asio::buffer(rxBuffer), [&] (const auto& error, size_t nBytes) {
+      BOOST_REQUIRE(!error);
+      nReceivedBytes += nBytes;
+      ++nReads;
+      if (nReceivedBytes < nTotalBytes) {
+        readMore();
+      }
+    });
+  };
+
+  auto d = timedExecute([&] {
+    for (const auto& wire : wires) {
+      transport->send(wire);
+    }
+    readMore();
+    while (nReceivedBytes < nTotalBytes) {
+      io.run_one();
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nReceivedBytes, nTotalBytes);
+  std::cout << N_INTERESTS << " Interests (" << nTotalBytes << " octets) in " << d
+            << ", received by peer in " << nReads << " reads" << std::endl;
+  transport->close();
+}
+
+} // namespace ndn::tests
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Validator Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
+#include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_context.hpp>
+
+#include <iostream>
+#include <thread>
+
+namespace ndn::tests {
+
+using namespace ndn::security;
+
+static void
+benchmarkValidation(const KeyParams& keyParams, const std::string& label)
+{
+  constexpr size_t N_PACKETS = 5000;
+  const size_t nCores = std::max(1U, std::thread::hardware_concurrency());
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Identity identity = keyChain.createIdentity("/localhost/benchmark/validator", keyParams);
+
+  std::vector<Data> packets;
+  packets.reserve(N_PACKETS);
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    Data& data = packets.emplace_back(Name(identity.getName()).appendSequenceNumber(i));
+    data.setFreshnessPeriod(1_s);
+    data.setContent(std::vector<uint8_t>(1000, 0xAB));
+    keyChain.sign(data, signingByIdentity(identity));
+  }
+
+  // 0 threads means synchronous verification on the io_context thread
+  std::vector<size_t> threadCounts{0};
+  for (size_t n = 1; n <= std::max<size_t>(4, nCores); n *= 2) {
+    threadCounts.push_back(n);
+  }
+
+  for (size_t nThreads : threadCounts) {
+    boost::asio::io_context ioCtx;
+    Validator validator(make_unique<ValidationPolicySimpleHierarchy>(),
+                        make_unique<CertificateFetcherOffline>());
+    validator.loadAnchor("", Certificate(identity.getDefaultKey().getDefaultCertificate()));
+    if (nThreads > 0) {
+      validator.enableAsyncVerification(ioCtx, nThreads);
+    }
+
+    size_t nValid = 0;
+    auto d = timedExecute([&] {
+      for (const auto& data : packets) {
+        validator.validate(data, [&] (const Data&) { ++nValid; }, [] (const Data&, const ValidationError&) {});
+      }
+      ioCtx.run();
+    });
+    BOOST_CHECK_EQUAL(nValid, N_PACKETS);
+
+    std::cout << label << ", " << nThreads << " verification thread(s): " << N_PACKETS << " Data in "
+              << d << ", " << static_cast<uint64_t>(N_PACKETS * 1e9 / d.count()) << " Data/s" << std::endl;
+  }
+}
+
+static void
+benchmarkBatchVerification(const KeyParams& keyParams, const std::string& label)
+{
+  constexpr size_t N_PACKETS = 5000;
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  Identity identity = keyChain.createIdentity("/localhost/benchmark/validator", keyParams);
+  Certificate cert = identity.getDefaultKey().getDefaultCertificate();
+
+  std::vector<Data> packets;
+  packets.reserve(N_PACKETS);
+  for (size_t i = 0; i < N_PACKETS; ++i) {
+    Data& data = packets.emplace_back(Name(identity.getName()).appendSequenceNumber(i));
+    data.setContent(std::vector<uint8_t>(1000, 0xAB));
+    keyChain.sign(data, signingByIdentity(identity));
+  }
+  std::vector<span<const uint8_t>> keys(N_PACKETS, cert.getPublicKey());
+
+  size_t nValid = 0;
+  auto d1 = timedExecute([&] {
+    for (const auto& data : packets) {
+      nValid += verifySignature(data, cert.getPublicKey());
+    }
+  });
+  BOOST_CHECK_EQUAL(nValid, N_PACKETS);
+
+  std::vector<bool> results;
+  auto d2 = timedExecute([&] { results = verifySignatures(packets, keys); });
+  BOOST_CHECK_EQUAL(static_cast<size_t>(std::count(results.begin(), results.end(), true)), N_PACKETS);
+
+  std::cout << label << ", " << N_PACKETS << " Data: " << d1 << " one by one, " << d2 << " in a batch"
+            << std::endl;
+}
+
+// Benchmark of a consumer that validates a stream of signed Data packets. With asynchronous
+// verification, throughput is expected to scale with the number of threads, up to the number
+// of available cores. For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Ecdsa)
+{
+  benchmarkValidation(EcKeyParams(), "ECDSA");
+}
+
+BOOST_AUTO_TEST_CASE(Rsa)
+{
+  benchmarkValidation(RsaKeyParams(), "RSA");
+}
+
+// Comparison of verifySignature() for each packet with a single call to verifySignatures().
+BOOST_AUTO_TEST_CASE(BatchVerification)
+{
+  benchmarkBatchVerification(EcKeyParams(), "ECDSA");
+  benchmarkBatchVerification(RsaKeyParams(), "RSA");
+}
+
+} // namespace ndn::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -178,6 +178,8 @@ BOOST_AUTO_TEST_CASE(Minimal)
   d.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
   d.setSignatureValue(std::make_shared<Buffer>());
   BOOST_CHECK_EQUAL(d.wireEncode(), "060B 0700 1400 16031B0100 1700"_block);
+  // the retained encoding does not hold a larger buffer
+  BOOST_CHECK_EQUAL(d.wireEncode().getBuffer()->size(), d.wireEncode().size());
 }
 
 BOOST_FIXTURE_TEST_CASE(Full, DataSigningKeyFixture)
@@ -296,6 +298,12 @@ BOOST_AUTO_TEST_CASE(Full)
   BOOST_REQUIRE(d.getKeyLocator().has_value());
   BOOST_CHECK_EQUAL(d.getKeyLocator()->getName(), "/test/key/locator");
   BOOST_CHECK_EQUAL(d.getSignatureValue().value_size(), 128);
+
+  // the wire encoding of the decoded packet is parsed
+  const Block& wire = d.wireEncode();
+  BOOST_CHECK_EQUAL(wire.elements_size(), 5);
+  BOOST_CHECK_EQUAL(wire.get(tlv::Content), d.getContent());
+  BOOST_CHECK(wire.find(tlv::SignatureValue) != wire.elements_end());
 }
 
 BOOST_AUTO_TEST_CASE(UnrecognizedNonCriticalElements)
@@ -390,8 +398,73 @@ BOOST_AUTO_TEST_CASE(UnrecognizedCriticalElement)
                         [] (const auto& e) { return e.what() == "Unrecognized element of critical type 251"sv; });
 }
 
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  d.wireDecodeLazy(Block(DATA1));
+  BOOST_CHECK_EQUAL(d.getName(), "/local/ndn/prefix");
+  BOOST_CHECK_EQUAL(readString(d.getContent()), "SUCCESS!");
+  BOOST_CHECK_EQUAL(d.getSignatureValue().value_size(), 128);
+  BOOST_CHECK_EQUAL(d.wireEncode(), Block(DATA1));
+  BOOST_CHECK_THROW(d.getMetaInfo(), Data::Error);
+  BOOST_CHECK_THROW(d.getFreshnessPeriod(), Data::Error);
+  BOOST_CHECK_THROW(d.getSignatureInfo(), Data::Error);
+  BOOST_CHECK_THROW(d.getKeyLocator(), Data::Error);
+  d.decodeRemaining();
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::SignatureSha256WithRsa);
+  BOOST_REQUIRE(d.getKeyLocator().has_value());
+  BOOST_CHECK_EQUAL(d.getKeyLocator()->getName(), "/test/key/locator");
+  BOOST_CHECK_EQUAL(d, Data(Block(DATA1)));
+  d.decodeRemaining(); // no-op
+
+  // modifying other fields does not lose the deferred elements
+  d.wireDecodeLazy(Block(DATA1));
+  d.setName("/E");
+  BOOST_CHECK_EQUAL(d.hasWire(), false);
+  Data decoded(d.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(decoded.getSignatureType(), tlv::SignatureSha256WithRsa);
+
+  // setters override the deferred elements
+  d.wireDecodeLazy(Block(DATA1));
+  d.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+  d.setFreshnessPeriod(1_s);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK_EQUAL(Data(d.wireEncode()).getFreshnessPeriod(), 1_s);
+}
+
+BOOST_AUTO_TEST_CASE(LazyMalformed)
+{
+  // structural errors are detected immediately
+  BOOST_CHECK_EXCEPTION(d.wireDecodeLazy("0607 0703080144 1700"_block), tlv::Error,
+                        [] (const auto& e) { return e.what() == "SignatureInfo element is missing"sv; });
+
+  // errors inside MetaInfo and SignatureInfo are reported by decodeRemaining()
+  d.wireDecodeLazy("0613 0703(080144) 1405(1903 010203) 1603(1B0100) 1700"_block);
+  BOOST_CHECK_EQUAL(d.getName(), "/D");
+  BOOST_CHECK_THROW(d.decodeRemaining(), tlv::Error);
+
+  d.wireDecodeLazy("060B 0703(080144) 1602(1C00) 1700"_block);
+  BOOST_CHECK_EQUAL(d.getName(), "/D");
+  BOOST_CHECK_THROW(d.decodeRemaining(), tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Decode
 
+BOOST_AUTO_TEST_CASE(PeekName)
+{
+  Block wire(DATA1);
+  wire.parse();
+  BOOST_TEST(Data::peekName(wire) == wire.get(tlv::Name), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(Name(Block(Data::peekName(DATA1))), "/local/ndn/prefix");
+  BOOST_TEST(Data::peekName("0609 0700 1603(1B0100) 1700"_block) == "0700"_block,
+             boost::test_tools::per_element());
+
+  BOOST_CHECK_THROW(Data::peekName("0503 0701 08"_block), tlv::Error); // not Data
+  BOOST_CHECK_THROW(Data::peekName("0607 16031B0100 1700"_block), tlv::Error); // no Name
+  BOOST_CHECK_THROW(Data::peekName(*fromHex("060507030801")), tlv::Error); // truncated
+}
+
 BOOST_FIXTURE_TEST_CASE(FullName, KeyChainFixture)
 {
   Data d(Name("/local/ndn/prefix"));
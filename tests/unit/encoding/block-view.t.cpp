@@ -0,0 +1,139 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/block-view.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <iterator>
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestBlockView)
+
+const uint8_t WIRE[] = {
+  0x06, 0x0c, // Data
+        0x07, 0x03, // Name
+              0x08, 0x01, 0x41,
+        0x14, 0x00, // MetaInfo
+        0xfd, 0x00, 0x15, 0x01, // Content, non-minimal TLV-TYPE
+              0xee,
+  0xff, 0xff // trailing bytes, not part of the element
+};
+
+BOOST_AUTO_TEST_CASE(Construct)
+{
+  BlockView invalid;
+  BOOST_CHECK_EQUAL(invalid.isValid(), false);
+  BOOST_CHECK_EQUAL(invalid.type(), tlv::Invalid);
+  BOOST_CHECK_EQUAL(invalid.size(), 0);
+  BOOST_CHECK(invalid.elements().begin() == invalid.elements().end());
+
+  BlockView view(WIRE);
+  BOOST_CHECK_EQUAL(view.isValid(), true);
+  BOOST_CHECK_EQUAL(view.type(), tlv::Data);
+  BOOST_CHECK_EQUAL(view.size(), 14);
+  BOOST_CHECK_EQUAL(view.value_size(), 12);
+  BOOST_CHECK(view.wire().data() == WIRE);
+  BOOST_CHECK(view.value().data() == WIRE + 2);
+
+  Block block(WIRE);
+  BlockView fromBlock(block);
+  BOOST_CHECK_EQUAL(fromBlock.type(), tlv::Data);
+  BOOST_CHECK(fromBlock.wire().data() == block.data());
+  BOOST_CHECK_EQUAL(fromBlock.size(), block.size());
+  BOOST_CHECK_EQUAL(fromBlock.value_size(), block.value_size());
+
+  BOOST_CHECK_THROW(BlockView(make_span(WIRE, 11)), tlv::Error);
+  BOOST_CHECK_THROW(BlockView(make_span(WIRE, 1)), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Elements)
+{
+  BlockView view(WIRE);
+  auto elements = view.elements();
+  BOOST_CHECK_EQUAL(std::distance(elements.begin(), elements.end()), 3);
+
+  auto it = elements.begin();
+  BOOST_CHECK_EQUAL(it->type(), tlv::Name);
+  BOOST_CHECK_EQUAL(it->size(), 5);
+  BOOST_CHECK_EQUAL(it->value_size(), 3);
+  auto nested = it->elements().begin();
+  BOOST_CHECK_EQUAL(nested->type(), tlv::GenericNameComponent);
+  BOOST_CHECK_EQUAL(nested->value()[0], 0x41);
+  BOOST_CHECK(++nested == it->elements().end());
+
+  ++it;
+  BOOST_CHECK_EQUAL(it->type(), tlv::MetaInfo);
+  BOOST_CHECK_EQUAL(it->value_size(), 0);
+
+  auto content = ++it;
+  BOOST_CHECK_EQUAL(content->type(), tlv::Content);
+  BOOST_CHECK_EQUAL(content->size(), 5);
+  BOOST_CHECK_EQUAL(content->value()[0], 0xee);
+  BOOST_CHECK(++it == elements.end());
+
+  // elements() yields the same sub-elements as Block::parse()
+  Block block(WIRE);
+  block.parse();
+  BOOST_TEST_REQUIRE(block.elements_size() == 3);
+  auto blockIt = block.elements_begin();
+  for (const auto& element : BlockView(block).elements()) {
+    BOOST_CHECK_EQUAL(element.type(), blockIt->type());
+    BOOST_TEST(element.wire() == *blockIt, boost::test_tools::per_element());
+    ++blockIt;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ElementsMalformed)
+{
+  const uint8_t malformed[] = {
+    0x06, 0x05,
+          0x07, 0x00,
+          0x14, 0x02, 0x00, // TLV-LENGTH exceeds the parent
+  };
+  auto elements = BlockView(malformed).elements();
+  auto it = elements.begin();
+  BOOST_CHECK_EQUAL(it->type(), tlv::Name);
+  BOOST_CHECK_THROW(++it, Block::Error);
+
+  const uint8_t truncatedFirst[] = {0x06, 0x01, 0x07};
+  BOOST_CHECK_THROW(BlockView(truncatedFirst).elements().begin(), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(ToBlock)
+{
+  Block block(WIRE);
+  auto it = BlockView(block).elements().begin();
+  std::advance(it, 2);
+  Block content = it->toBlock(block);
+  BOOST_CHECK_EQUAL(content.type(), tlv::Content);
+  BOOST_CHECK_EQUAL(content.size(), 5);
+  BOOST_CHECK_EQUAL(content.value_size(), 1);
+  BOOST_CHECK(content.data() == block.data() + 9);
+  BOOST_CHECK(content.getBuffer() == block.getBuffer());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBlockView
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace ndn::tests
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/buffer-pool.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/data.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <set>
+#include <thread>
+
+namespace ndn::tests {
+
+using encoding::BufferPool;
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestBufferPool)
+
+BOOST_AUTO_TEST_CASE(SizeClasses)
+{
+  BufferPool pool;
+  BOOST_CHECK_EQUAL(pool.allocate(0)->size(), 64);
+  BOOST_CHECK_EQUAL(pool.allocate(64)->size(), 64);
+  BOOST_CHECK_EQUAL(pool.allocate(65)->size(), 128);
+  BOOST_CHECK_EQUAL(pool.allocate(8800)->size(), 16384);
+  BOOST_CHECK_EQUAL(pool.allocate(16384)->size(), 16384);
+  BOOST_CHECK_EQUAL(pool.size(), 3);
+
+  // too large to be pooled
+  BOOST_CHECK_EQUAL(pool.allocate(16385)->size(), 16385);
+  BOOST_CHECK_EQUAL(pool.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Recycle)
+{
+  BufferPool pool;
+  auto b1 = pool.allocate(100);
+  auto b2 = pool.allocate(100);
+  BOOST_CHECK_NE(b1, b2);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+
+  const Buffer* p1 = b1.get();
+  std::weak_ptr<Buffer> weak1 = b1;
+  b1.reset();
+  // a weak_ptr does not prevent recycling, and cannot observe the recycled buffer
+  BOOST_CHECK(weak1.expired());
+  auto b3 = pool.allocate(120);
+  BOOST_CHECK_EQUAL(b3.get(), p1);
+  BOOST_CHECK(weak1.lock() == nullptr);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+
+  // a buffer that is still referenced through a Block is not recycled
+  (*b2)[0] = tlv::GenericNameComponent;
+  (*b2)[1] = 0;
+  Block block(b2, b2->begin(), b2->begin() + 2);
+  b2.reset();
+  b3.reset();
+  auto b4 = pool.allocate(100);
+  BOOST_CHECK_EQUAL(b4.get(), p1);
+  auto b5 = pool.allocate(100);
+  BOOST_CHECK_NE(b5.get(), p1);
+  BOOST_CHECK_NE(b5.get(), block.getBuffer().get());
+  BOOST_CHECK_EQUAL(pool.size(), 3);
+
+  // buffers released on another thread are recycled
+  const Buffer* p5 = b5.get();
+  b4.reset();
+  std::thread([b = std::move(b5)] () mutable { b.reset(); }).join();
+  std::set<const Buffer*> recycled{pool.allocate(100).get(), pool.allocate(100).get()};
+  BOOST_CHECK_EQUAL(recycled.count(p1), 1);
+  BOOST_CHECK_EQUAL(recycled.count(p5), 1);
+  BOOST_CHECK_EQUAL(pool.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(OutlivePool)
+{
+  shared_ptr<Buffer> buffer;
+  {
+    BufferPool pool;
+    buffer = pool.allocate(100);
+  }
+  // the buffer remains valid after the pool is destroyed
+  std::fill(buffer->begin(), buffer->end(), 0xbb);
+  BOOST_CHECK_EQUAL(buffer->size(), 128);
+}
+
+BOOST_AUTO_TEST_CASE(Full)
+{
+  BufferPool pool(2);
+  auto b1 = pool.allocate(100);
+  auto b2 = pool.allocate(100);
+  auto b3 = pool.allocate(100);
+  BOOST_CHECK_EQUAL(b1->size(), 128);
+  BOOST_CHECK_EQUAL(b2->size(), 128);
+  BOOST_CHECK_EQUAL(b3->size(), 100);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+
+  // an unpooled buffer is not retained
+  b3.reset();
+  auto b4 = pool.allocate(100);
+  BOOST_CHECK_EQUAL(b4->size(), 100);
+  BOOST_CHECK_EQUAL(pool.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Encoder)
+{
+  BufferPool pool;
+  const Buffer* first = nullptr;
+  {
+    EncodingBuffer encoder(pool, 10, 0);
+    BOOST_CHECK_EQUAL(encoder.capacity(), 64);
+    first = encoder.getBuffer().get();
+
+    // growing the buffer takes another buffer from the pool
+    std::vector<uint8_t> bytes(100, 0xaa);
+    encoder.prependBytes(bytes);
+    BOOST_CHECK_EQUAL(encoder.size(), 100);
+    BOOST_CHECK_EQUAL(encoder.capacity(), 256);
+    BOOST_CHECK_EQUAL(pool.size(), 2);
+  }
+
+  EncodingBuffer encoder(pool, 10, 0);
+  BOOST_CHECK_EQUAL(encoder.getBuffer().get(), first);
+}
+
+BOOST_AUTO_TEST_CASE(DataWireEncode)
+{
+  auto makeData = [] (const Name& name) {
+    Data data(name);
+    data.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+    data.setSignatureValue(std::make_shared<Buffer>(32));
+    return data;
+  };
+
+  BufferPool& pool = BufferPool::getThreadLocal();
+  {
+    Data data = makeData("/A");
+    BOOST_CHECK(data.wireEncode().hasWire());
+  }
+  size_t poolSize = pool.size();
+
+  // the buffer released by the previous packet is reused
+  Data data = makeData("/B");
+  BOOST_CHECK(data.wireEncode().hasWire());
+  BOOST_CHECK_EQUAL(pool.size(), poolSize);
+  BOOST_CHECK_EQUAL(Data(data.wireEncode()).getName(), "/B");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBufferPool
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace ndn::tests
@@ -29,6 +29,7 @@
 #include "tests/test-common.hpp"
 #include "tests/unit/io-key-chain-fixture.hpp"
 
+#include <boost/lexical_cast.hpp>
 #include <boost/logic/tribool.hpp>
 #include <boost/mp11/list.hpp>
 
@@ -145,6 +146,38 @@ BOOST_AUTO_TEST_CASE(MultipleData)
   BOOST_CHECK_EQUAL(face.sentData.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(DataMatching)
+{
+  auto data = makeData("/A/B/C");
+  std::vector<std::string> satisfied;
+  auto express = [&] (const Name& name, bool canBePrefix) {
+    face.expressInterest(*makeInterest(name, canBePrefix, 50_ms),
+                         [&] (const Interest& i, auto&&) { satisfied.push_back(i.getName().toUri()); },
+                         [] (auto&&...) { BOOST_FAIL("Unexpected Nack"); },
+                         [] (auto&&...) {});
+  };
+
+  express("/A", true);
+  express("/A/B", false); // not satisfied: CanBePrefix is false
+  express("/A/B", true);
+  express("/A/B/C", false);
+  express("/A/B/C/D", true); // not satisfied: longer than Data name
+  express(data->getFullName(), false);
+  express("/A/B/C/sha256digest=0000000000000000000000000000000000000000000000000000000000000000",
+          false); // not satisfied: wrong digest
+  express("/A/X", true); // not satisfied: not a prefix
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 8);
+
+  face.receive(*data);
+  advanceClocks(1_ms);
+
+  // Data callbacks are invoked in the order in which the Interests were expressed
+  std::vector<std::string> expected{"/A", "/A/B", "/A/B/C", data->getFullName().toUri()};
+  BOOST_TEST(satisfied == expected, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 4);
+}
+
 BOOST_AUTO_TEST_CASE(EmptyDataCallback)
 {
   face.expressInterest(*makeInterest("/Hello/World", true),
@@ -714,6 +747,26 @@ BOOST_AUTO_TEST_CASE(SimilarFilters)
   BOOST_CHECK_EQUAL(nInInterests3, 0);
 }
 
+BOOST_AUTO_TEST_CASE(DispatchOrder)
+{
+  std::vector<std::string> invoked;
+  for (const auto& filter : {InterestFilter("/A/B"), InterestFilter("/"), InterestFilter("/A/C"),
+                             InterestFilter("/A", "<B><>"), InterestFilter("/A/B/c"),
+                             InterestFilter("/A"), InterestFilter("/A", "<C>")}) {
+    face.setInterestFilter(filter, [&] (const InterestFilter& f, auto&&) {
+      invoked.push_back(boost::lexical_cast<std::string>(f));
+    });
+  }
+  advanceClocks(1_ms);
+
+  face.receive(*makeInterest("/A/B/c"));
+  advanceClocks(1_ms);
+
+  // filters are invoked in the order in which they were set
+  std::vector<std::string> expected{"/A/B", "/", "/A?regex=<B><>", "/A/B/c", "/A"};
+  BOOST_TEST(invoked == expected, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(RegexFilter)
 {
   size_t nInInterests = 0;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -594,6 +594,29 @@ BOOST_AUTO_TEST_CASE(MustBeFresh)
   BOOST_CHECK_EQUAL(find(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_MustBeFresh)
+{
+  Name n1 = insert(1, "/A", nullptr, 1_s);
+  Name n2 = insert(2, "/A", nullptr, 1_h);
+  insert(3, "/A/B");
+
+  // among several packets with the Interest name, the leftmost one is returned
+  advanceClocks(500_ms);
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), n1 < n2 ? 1 : 2);
+
+  // stale packets are skipped
+  advanceClocks(1_s);
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+
+  advanceClocks(1_h);
+  startInterest("/A")
+    .setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Find
 BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorage
 BOOST_AUTO_TEST_SUITE_END() // Ims
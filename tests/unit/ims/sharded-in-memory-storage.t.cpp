@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/sharded-in-memory-storage.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestShardedInMemoryStorage)
+
+BOOST_AUTO_TEST_CASE(ShardIndex)
+{
+  ShardedInMemoryStorage ims(4, 2);
+  BOOST_CHECK_EQUAL(ims.getNShards(), 4);
+  BOOST_CHECK(!ims.getShardIndex("/A"));
+  BOOST_REQUIRE(ims.getShardIndex("/A/B"));
+  BOOST_CHECK_EQUAL(*ims.getShardIndex("/A/B"), *ims.getShardIndex("/A/B/C/D"));
+  BOOST_CHECK_LT(*ims.getShardIndex("/A/B"), 4);
+
+  BOOST_CHECK_THROW(ShardedInMemoryStorage(0, 2), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  ShardedInMemoryStorage ims(4, 2);
+  std::vector<Name> fullNames;
+  for (int i = 0; i < 50; ++i) {
+    auto data = makeData(Name("/A").appendNumber(i).append("x"));
+    ims.insert(*data);
+    fullNames.push_back(data->getFullName());
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 50);
+
+  for (int i = 0; i < 50; ++i) {
+    BOOST_TEST_CONTEXT("i=" << i) {
+      // routed to a single shard
+      auto found = ims.find(*makeInterest(Name("/A").appendNumber(i), true));
+      BOOST_REQUIRE(found != nullptr);
+      BOOST_CHECK_EQUAL(found->getFullName(), fullNames[i]);
+      BOOST_CHECK(ims.find(*makeInterest(fullNames[i])) == found);
+      BOOST_CHECK(ims.find(fullNames[i]) == found);
+    }
+  }
+  BOOST_CHECK(ims.find(*makeInterest("/A/9999", true)) == nullptr);
+
+  // names shorter than prefixLength are looked up in every shard,
+  // and the leftmost match is returned
+  auto found = ims.find(*makeInterest("/A", true));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), Name("/A").appendNumber(0).append("x"));
+  found = ims.find(Name("/A"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), Name("/A").appendNumber(0).append("x"));
+}
+
+BOOST_AUTO_TEST_CASE(ShortFullName)
+{
+  ShardedInMemoryStorage ims(4, 3);
+  auto data = makeData("/A");
+  ims.insert(*data);
+
+  BOOST_CHECK(ims.find(*makeInterest("/A")) != nullptr);
+  BOOST_CHECK(ims.find(*makeInterest(data->getFullName())) != nullptr);
+  ims.erase(data->getFullName(), false);
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  ShardedInMemoryStorage ims(4, 2);
+  for (int i = 0; i < 10; ++i) {
+    ims.insert(*makeData(Name("/A").appendNumber(i).append("x")));
+    ims.insert(*makeData(Name("/B").appendNumber(i).append("x")));
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 20);
+
+  ims.erase(Name("/A").appendNumber(3));
+  BOOST_CHECK_EQUAL(ims.size(), 19);
+  ims.erase("/B");
+  BOOST_CHECK_EQUAL(ims.size(), 9);
+  BOOST_CHECK(ims.find(*makeInterest("/B", true)) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/A", true)) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ShardPolicy)
+{
+  ShardedInMemoryStorage ims(2, 1, [] { return make_unique<InMemoryStorageLru>(5); });
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData(Name("/A").appendNumber(i)));
+  }
+  // all packets are in the same shard, which keeps up to 5 packets
+  BOOST_CHECK_EQUAL(ims.size(), 5);
+  BOOST_CHECK(ims.find(*makeInterest(Name("/A").appendNumber(99))) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Concurrent)
+{
+  constexpr int N_THREADS = 4;
+  constexpr int N_PACKETS = 200;
+  ShardedInMemoryStorage ims(8, 2);
+
+  // Data packets are prepared beforehand, because the signing KeyChain is not thread-safe
+  std::vector<std::vector<shared_ptr<Data>>> packets(N_THREADS);
+  for (int t = 0; t < N_THREADS; ++t) {
+    for (int i = 0; i < N_PACKETS; ++i) {
+      auto data = makeData(Name("/T").appendNumber(t).appendNumber(i));
+      data->getFullName();
+      packets[t].push_back(std::move(data));
+    }
+  }
+
+  std::vector<int> nFound(N_THREADS);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < N_THREADS; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < N_PACKETS; ++i) {
+        ims.insert(*packets[t][i]);
+        Interest interest(packets[t][i]->getName());
+        if (ims.find(interest) != nullptr) {
+          ++nFound[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  BOOST_CHECK_EQUAL(ims.size(), N_THREADS * N_PACKETS);
+  for (int t = 0; t < N_THREADS; ++t) {
+    BOOST_CHECK_EQUAL(nFound[t], N_PACKETS);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShardedInMemoryStorage
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace ndn::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -93,6 +93,8 @@ BOOST_AUTO_TEST_CASE(Basic)
 
   Block wire1 = i1.wireEncode();
   BOOST_TEST(wire1 == WIRE, boost::test_tools::per_element());
+  // the retained encoding does not hold a larger buffer
+  BOOST_CHECK_EQUAL(wire1.getBuffer()->size(), wire1.size());
 
   Interest i2(wire1);
   BOOST_CHECK_EQUAL(i2.getName(), "/local/ndn/prefix");
@@ -449,8 +451,10 @@ BOOST_AUTO_TEST_CASE(FullWithoutParameters)
   BOOST_CHECK_EQUAL(i.hasApplicationParameters(), false);
   BOOST_CHECK_EQUAL(i.getApplicationParameters().isValid(), false);
 
-  // encode without modification: retain original wire encoding
+  // encode without modification: retain original wire encoding, with its sub-elements
   BOOST_CHECK_EQUAL(i.wireEncode().value_size(), 49);
+  BOOST_CHECK_EQUAL(i.wireEncode().elements_size(), 14);
+  BOOST_CHECK_EQUAL(i.wireEncode().get(tlv::Nonce).value_size(), 4);
 
   // modify then re-encode:
   // * unrecognized elements are discarded;
@@ -668,8 +672,53 @@ BOOST_AUTO_TEST_CASE(UnrecognizedCriticalElement)
                         [] (const auto& e) { return e.what() == "Unrecognized element of critical type 9"sv; });
 }
 
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  const Block wire("0531 0703(080149) "
+                   "FC00 2100 FC00 1200 FC00 1E0B(1F09 1E023E15 0703080148) "
+                   "FC00 0A044ACB1E4C FC00 0C0276A1 FC00 2201D6 FC00"_block);
+  i.wireDecodeLazy(wire);
+  BOOST_CHECK_EQUAL(i.getName(), "/I");
+  BOOST_CHECK_EQUAL(i.getCanBePrefix(), true);
+  BOOST_CHECK_EQUAL(i.getNonce(), 0x4acb1e4c);
+  BOOST_CHECK_EQUAL(i.wireEncode(), wire);
+  BOOST_CHECK_THROW(i.getForwardingHint(), Interest::Error);
+  i.decodeRemaining();
+  BOOST_TEST(i.getForwardingHint() == std::vector<Name>({"/H"}), boost::test_tools::per_element());
+
+  // re-encoding copies the deferred ForwardingHint verbatim
+  i.wireDecodeLazy(wire);
+  i.setName("/J");
+  BOOST_CHECK_EQUAL(i.wireEncode(),
+                    "0523 0703(08014A) "
+                    "2100 1200 1E0B(1F09 1E023E15 0703080148) "
+                    "0A044ACB1E4C 0C0276A1 2201D6"_block);
+
+  // errors inside ForwardingHint are reported by decodeRemaining()
+  i.wireDecodeLazy("050C 0703080149 1E05(0703080248)"_block);
+  BOOST_CHECK_EQUAL(i.getName(), "/I");
+  BOOST_CHECK_EXCEPTION(i.decodeRemaining(), tlv::Error,
+    [] (const auto& e) { return e.what() == "Invalid Name in ForwardingHint"sv; });
+
+  // the parameters digest is not checked
+  Block mismatch("052B 0725(080149 02200000000000000000000000000000000000000000000000000000000000000000) "
+                 "2402CAFE"_block);
+  BOOST_CHECK_NO_THROW(i.wireDecodeLazy(mismatch));
+  BOOST_CHECK_EQUAL(i.isParametersDigestValid(), false);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Decode
 
+BOOST_AUTO_TEST_CASE(PeekName)
+{
+  BOOST_TEST(Interest::peekName("0508 0703(080149) 2201D6"_block) == "0703080149"_block,
+             boost::test_tools::per_element());
+
+  BOOST_CHECK_THROW(Interest::peekName("0605 0703080149"_block), tlv::Error); // not Interest
+  BOOST_CHECK_THROW(Interest::peekName("0503 2201D6"_block), tlv::Error); // no Name
+  BOOST_CHECK_THROW(Interest::peekName("0500"_block), tlv::Error); // empty
+}
+
 BOOST_AUTO_TEST_CASE(MatchesData)
 {
   auto interest = makeInterest("/A");
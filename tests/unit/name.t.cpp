@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -86,6 +86,35 @@ BOOST_AUTO_TEST_CASE(EncodeDecode)
   BOOST_TEST(name.toUri(name::UriFormat::CANONICAL) == "/8=world");
 }
 
+BOOST_AUTO_TEST_CASE(DecodeKeepsWire)
+{
+  Block wire("0706 080141 080142"_block);
+  Name name(wire);
+  BOOST_CHECK_EQUAL(name.hasWire(), true);
+  BOOST_CHECK(name.wireEncode().data() == wire.data());
+
+  // component objects refer to the same buffer
+  BOOST_CHECK(name[1].data() == wire.data() + 5);
+  BOOST_CHECK_EQUAL(name[1], Component("B"));
+
+  BOOST_CHECK_THROW(Name("0704 08054142"_block), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeNonMinimal)
+{
+  // TLV-TYPE and TLV-LENGTH of the second component are not minimally encoded
+  Name name("070B 080141 FD0008FD00024243"_block);
+  // the non-canonical encoding is not retained
+  BOOST_CHECK_EQUAL(name.hasWire(), false);
+  BOOST_CHECK_EQUAL(name.size(), 2);
+  BOOST_CHECK_EQUAL(name[1], Component("BC"));
+  BOOST_CHECK_EQUAL(name, Name("/A/BC"));
+  BOOST_CHECK_EQUAL(std::hash<Name>{}(name), std::hash<Name>{}(Name("/A/BC")));
+
+  // the canonical encoding is used when re-encoding
+  BOOST_CHECK_EQUAL(name.wireEncode(), "0707 080141 08024243"_block);
+}
+
 BOOST_AUTO_TEST_CASE(ParseUri)
 {
   // canonical URI
@@ -558,6 +587,50 @@ BOOST_AUTO_TEST_CASE(CompareFunc)
   BOOST_CHECK_GT   (Name("/Z/A/C/Y").compare(1, 2, Name("/X/A"),   1), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name("/A/B/C");
+  BOOST_CHECK_EQUAL(name.getHash(), std::hash<Name>{}(name));
+  BOOST_CHECK_EQUAL(name.getHash(), Name("0709 080141 080142 080143"_block).getHash());
+  BOOST_CHECK_NE(name.getHash(), Name("/A/B/D").getHash());
+
+  // the value is updated by every modification
+  name.append("D");
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C/D").getHash());
+  name.set(0, Component("Z"));
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/Z/B/C/D").getHash());
+  name.erase(-1);
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/Z/B/C").getHash());
+  name.wireDecode("0703 080141"_block);
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A").getHash());
+  name.clear();
+  BOOST_CHECK_EQUAL(name.getHash(), Name().getHash());
+}
+
+BOOST_AUTO_TEST_CASE(PrefixHash)
+{
+  Name name("/A/B/C/D");
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_TEST_CONTEXT("i=" << i) {
+      BOOST_CHECK_EQUAL(name.getPrefixHash(i), name.getPrefix(i).getHash());
+    }
+  }
+  BOOST_CHECK_EQUAL(name.getPrefixHash(Name::npos), name.getHash());
+
+  name.append("E");
+  BOOST_CHECK_EQUAL(name.getPrefixHash(5), Name("/A/B/C/D/E").getHash());
+  BOOST_CHECK_EQUAL(name.getPrefixHash(1), Name("/A").getHash());
+
+  name.append(Name("/F/G"));
+  BOOST_CHECK_EQUAL(name.getPrefixHash(6), Name("/A/B/C/D/E/F").getHash());
+  BOOST_CHECK_EQUAL(name.getHash(), Name("/A/B/C/D/E/F/G").getHash());
+
+  Name suffix = name.getSubName(2, 3);
+  BOOST_CHECK_EQUAL(suffix.getPrefixHash(2), Name("/C/D").getHash());
+  BOOST_CHECK_EQUAL(suffix.getHash(), Name("/C/D/E").getHash());
+  BOOST_CHECK_EQUAL(Name().getPrefixHash(1), 0);
+}
+
 BOOST_AUTO_TEST_CASE(UnorderedMapKey)
 {
   std::unordered_map<Name, int> map;
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/impl/public-key-cache.hpp"
+
+#include "ndn-cxx/security/key-params.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using ndn::security::detail::PublicKeyCache;
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(TestPublicKeyCache)
+
+static ConstBufferPtr
+makePublicKey()
+{
+  return security::transform::generatePrivateKey(EcKeyParams())->derivePublicKey();
+}
+
+BOOST_AUTO_TEST_CASE(Get)
+{
+  PublicKeyCache cache(2);
+  auto key1 = makePublicKey();
+  auto key2 = makePublicKey();
+  auto key3 = makePublicKey();
+
+  auto parsed1 = cache.get(*key1);
+  BOOST_REQUIRE(parsed1 != nullptr);
+  BOOST_CHECK_EQUAL(parsed1->getKeyType(), KeyType::EC);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+
+  // same key bytes in a different buffer
+  Buffer key1Copy(key1->begin(), key1->end());
+  BOOST_CHECK_EQUAL(cache.get(key1Copy), parsed1);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+
+  auto parsed2 = cache.get(*key2);
+  BOOST_REQUIRE(parsed2 != nullptr);
+  BOOST_CHECK_NE(parsed2, parsed1);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+
+  // key1 is more recently used than key2, so key2 is evicted
+  BOOST_CHECK_EQUAL(cache.get(*key1), parsed1);
+  BOOST_CHECK(cache.get(*key3) != nullptr);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.get(*key1), parsed1);
+  BOOST_CHECK_NE(cache.get(*key2), parsed2);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK_NE(cache.get(*key1), parsed1);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  PublicKeyCache cache(2);
+  const std::vector<uint8_t> garbage{0x30, 0x03, 0x02, 0x01, 0x00};
+  BOOST_CHECK(cache.get(garbage) == nullptr);
+  BOOST_CHECK(cache.get({}) == nullptr);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPublicKeyCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace ndn::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,7 +20,9 @@
  */
 
 #include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/encoding/tlv-security.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 
 #include "tests/boost-test.hpp"
@@ -30,6 +32,8 @@
 
 #include <boost/mp11/list.hpp>
 
+#include <thread>
+
 namespace ndn::tests {
 
 using namespace ndn::security;
@@ -210,6 +214,171 @@ BOOST_FIXTURE_TEST_CASE(SigningWithNonExistingIdentity, KeyChainFixture)
                     KeyChain::InvalidSigningInfoError);
 }
 
+BOOST_FIXTURE_TEST_CASE(SignerCache, KeyChainFixture)
+{
+  Identity id1 = m_keyChain.createIdentity("/test/id1");
+  Key key1 = id1.getDefaultKey();
+  const Name key1Name = key1.getName();
+  const Name cert1Name = key1.getDefaultCertificate().getName();
+  m_keyChain.setDefaultIdentity(id1);
+
+  auto signAndGetKeyLocator = [this] (const SigningInfo& params) {
+    Data data("/test/data");
+    m_keyChain.sign(data, params);
+    return data.getKeyLocator().value().getName();
+  };
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(signingByIdentity(id1)), cert1Name);
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(SigningInfo()), cert1Name);
+
+  // the cached signer follows changes of the default key
+  Key key2 = m_keyChain.createKey(id1);
+  m_keyChain.setDefaultKey(id1, key2);
+  Certificate cert2 = key2.getDefaultCertificate();
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(signingByIdentity(id1)), cert2.getName());
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(SigningInfo()), cert2.getName());
+
+  // ... of the default certificate
+  Certificate cert3 = m_keyChain.makeCertificate(key2, signingByKey(key1));
+  m_keyChain.addCertificate(key2, cert3);
+  m_keyChain.setDefaultCertificate(key2, cert3);
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(signingByKey(key2)), cert3.getName());
+  m_keyChain.deleteCertificate(key2, cert3.getName());
+  m_keyChain.deleteCertificate(key2, cert2.getName());
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(signingByKey(key2)), key2.getName());
+
+  // ... of the default identity
+  Identity id2 = m_keyChain.createIdentity("/test/id2");
+  m_keyChain.setDefaultIdentity(id2);
+  BOOST_CHECK_EQUAL(signAndGetKeyLocator(SigningInfo()),
+                    id2.getDefaultKey().getDefaultCertificate().getName());
+
+  // ... and of deletions
+  m_keyChain.deleteIdentity(id1);
+  Data data("/test/data");
+  BOOST_CHECK_THROW(m_keyChain.sign(data, signingByIdentity("/test/id1")),
+                    KeyChain::InvalidSigningInfoError);
+  BOOST_CHECK_THROW(m_keyChain.sign(data, signingByKey(key1Name)),
+                    KeyChain::InvalidSigningInfoError);
+
+  // the SignatureInfo supplied with each SigningInfo is not cached
+  SignatureInfo sigInfo;
+  sigInfo.setTime(time::system_clock::now());
+  Interest interest("/test/interest");
+  m_keyChain.sign(interest, signingByIdentity(id2).setSignatureInfo(sigInfo)
+                                                  .setSignedInterestFormat(SignedInterestFormat::V03));
+  BOOST_REQUIRE(interest.getSignatureInfo());
+  BOOST_CHECK(interest.getSignatureInfo()->getTime().has_value());
+  m_keyChain.sign(interest, signingByIdentity(id2).setSignedInterestFormat(SignedInterestFormat::V03));
+  BOOST_REQUIRE(interest.getSignatureInfo());
+  BOOST_CHECK(!interest.getSignatureInfo()->getTime().has_value());
+}
+
+BOOST_FIXTURE_TEST_CASE(SignWithContext, KeyChainFixture)
+{
+  Identity id = m_keyChain.createIdentity("/test");
+  Key key = id.getDefaultKey();
+  Certificate cert = key.getDefaultCertificate();
+
+  auto ctx = m_keyChain.prepareSigningContext(signingByIdentity(id));
+  BOOST_CHECK_EQUAL(ctx.getKeyName(), key.getName());
+  BOOST_CHECK_EQUAL(ctx.getSignatureInfo().getKeyLocator().getName(), cert.getName());
+  BOOST_CHECK(ctx.getDigestAlgorithm() == DigestAlgorithm::SHA256);
+
+  // the same SigningContext can be used concurrently
+  std::vector<Data> packets;
+  for (int i = 0; i < 64; ++i) {
+    packets.emplace_back(Name("/test/data").appendSegment(i));
+  }
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = t; i < packets.size(); i += 4) {
+        m_keyChain.sign(packets[i], ctx);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& data : packets) {
+    BOOST_CHECK_EQUAL(data.getKeyLocator().value().getName(), cert.getName());
+    BOOST_CHECK(verifySignature(data, key));
+    // the signed packet does not retain a larger buffer than its encoding
+    BOOST_CHECK_EQUAL(data.wireEncode().getBuffer()->size(), data.wireEncode().size());
+  }
+
+  auto digestCtx = m_keyChain.prepareSigningContext(signingWithSha256());
+  Data data("/test/digest");
+  m_keyChain.sign(data, digestCtx);
+  BOOST_CHECK_EQUAL(data.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK(verifySignature(data, std::nullopt));
+
+  BOOST_CHECK_THROW(m_keyChain.prepareSigningContext(signingByIdentity("/non-existing/identity")),
+                    KeyChain::InvalidSigningInfoError);
+
+  // the SigningContext holds the private key, which remains usable after the key is deleted
+  m_keyChain.deleteKey(id, key);
+  BOOST_CHECK_THROW(m_keyChain.prepareSigningContext(signingByIdentity(id)),
+                    KeyChain::InvalidSigningInfoError);
+  Data afterDelete("/test/deleted");
+  m_keyChain.sign(afterDelete, ctx);
+  BOOST_CHECK(verifySignature(afterDelete, cert));
+}
+
+BOOST_FIXTURE_TEST_CASE(SignBatch, KeyChainFixture)
+{
+  Identity id = m_keyChain.createIdentity("/test");
+  Key key = id.getDefaultKey();
+
+  std::vector<Data> packets;
+  std::vector<Data*> batch;
+  for (int i = 0; i < 7; ++i) {
+    auto& data = packets.emplace_back(Name("/test/batch").appendSegment(i));
+    data.setContent(std::vector<uint8_t>(100, static_cast<uint8_t>(i)));
+  }
+  for (auto& data : packets) {
+    batch.push_back(&data);
+  }
+  m_keyChain.signBatch(batch, signingByIdentity(id));
+
+  for (const auto& data : packets) {
+    BOOST_CHECK_EQUAL(data.getSignatureType(), tlv::SignatureSha256WithEcdsa);
+    BOOST_CHECK_EQUAL(data.getKeyLocator().value().getName(), key.getDefaultCertificate().getName());
+    BOOST_CHECK(data.getSignatureInfo().getCustomTlv(tlv::security::MerkleAuditPath));
+    // all packets of the batch carry the same signature
+    BOOST_CHECK_EQUAL(data.getSignatureValue(), packets.front().getSignatureValue());
+    BOOST_CHECK(verifySignature(data, key));
+    BOOST_CHECK(verifySignature(Data(data.wireEncode()), key.getPublicKey()));
+  }
+  transform::PublicKey pubKey;
+  pubKey.loadPkcs8(key.getPublicKey());
+  BOOST_CHECK(verifySignatures(packets, pubKey));
+
+  // tampered content
+  Data tampered(packets[3]);
+  tampered.setContent(std::vector<uint8_t>(100, 0xFF));
+  BOOST_CHECK(!verifySignature(tampered, key));
+  packets[3] = tampered;
+  BOOST_CHECK(!verifySignatures(packets, pubKey));
+
+  // audit path of another packet
+  Data swapped(packets[1]);
+  auto sigInfo = swapped.getSignatureInfo();
+  sigInfo.addCustomTlv(packets[2].getSignatureInfo().getCustomTlv(tlv::security::MerkleAuditPath).value());
+  swapped.setSignatureInfo(sigInfo);
+  BOOST_CHECK(!verifySignature(swapped, key));
+
+  // a batch of one packet, signed with a digest
+  Data single("/test/single");
+  std::vector<Data*> singleBatch{&single};
+  m_keyChain.signBatch(singleBatch, signingWithSha256());
+  BOOST_CHECK_EQUAL(single.getSignatureType(), tlv::DigestSha256);
+  BOOST_CHECK(verifySignature(single, std::nullopt));
+
+  // empty batch
+  BOOST_CHECK_NO_THROW(m_keyChain.signBatch({}, signingWithSha256()));
+}
+
 BOOST_FIXTURE_TEST_CASE(Management, KeyChainFixture)
 {
   BOOST_CHECK_EQUAL(m_keyChain.getPib().getIdentities().size(), 0);
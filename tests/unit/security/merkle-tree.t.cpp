@@ -0,0 +1,180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/merkle-tree.hpp"
+#include "ndn-cxx/util/concepts.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn::tests {
+
+using ndn::security::MerkleAuditPath;
+using ndn::security::MerkleDigest;
+using ndn::security::MerkleTree;
+
+BOOST_CONCEPT_ASSERT((boost::EqualityComparable<MerkleAuditPath>));
+BOOST_CONCEPT_ASSERT((WireEncodable<MerkleAuditPath>));
+BOOST_CONCEPT_ASSERT((WireEncodableWithEncodingBuffer<MerkleAuditPath>));
+BOOST_CONCEPT_ASSERT((WireDecodable<MerkleAuditPath>));
+static_assert(std::is_convertible_v<MerkleAuditPath::Error*, tlv::Error*>,
+              "MerkleAuditPath::Error must inherit from tlv::Error");
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(TestMerkleTree)
+
+static std::vector<MerkleDigest>
+makeLeaves(size_t n)
+{
+  std::vector<MerkleDigest> leaves(n);
+  for (size_t i = 0; i < n; ++i) {
+    leaves[i].fill(static_cast<uint8_t>(i + 1));
+  }
+  return leaves;
+}
+
+BOOST_AUTO_TEST_CASE(AuditPaths)
+{
+  BOOST_CHECK_THROW(MerkleTree({}), std::invalid_argument);
+
+  for (size_t nLeaves = 1; nLeaves <= 17; ++nLeaves) {
+    BOOST_TEST_CONTEXT("nLeaves=" << nLeaves) {
+      auto leaves = makeLeaves(nLeaves);
+      MerkleTree tree(leaves);
+      BOOST_TEST(tree.getLeafCount() == nLeaves);
+      BOOST_CHECK_THROW(tree.getAuditPath(nLeaves), std::out_of_range);
+
+      for (size_t i = 0; i < nLeaves; ++i) {
+        auto path = tree.getAuditPath(i);
+        BOOST_TEST(path.getLeafIndex() == i);
+        BOOST_TEST(path.getLeafCount() == nLeaves);
+        BOOST_TEST(path.getSiblings().size() <= 5);
+        BOOST_CHECK(path.computeRoot(leaves[i]).value() == tree.getRoot());
+        // a different leaf does not lead to the same root
+        if (nLeaves > 1) {
+          BOOST_CHECK(path.computeRoot(leaves[(i + 1) % nLeaves]) != tree.getRoot());
+        }
+      }
+    }
+  }
+
+  MerkleTree single(makeLeaves(1));
+  BOOST_CHECK(single.getRoot() == makeLeaves(1).front());
+  BOOST_TEST(single.getAuditPath(0).getSiblings().empty());
+
+  MerkleTree three(makeLeaves(3));
+  auto leaves = makeLeaves(3);
+  auto expectedRoot = MerkleTree::computeNode(MerkleTree::computeNode(leaves[0], leaves[1]), leaves[2]);
+  BOOST_CHECK(three.getRoot() == expectedRoot);
+  // the last leaf is promoted, so that it has only one sibling
+  BOOST_TEST(three.getAuditPath(2).getSiblings().size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(InconsistentPath)
+{
+  auto leaves = makeLeaves(5);
+  MerkleTree tree(leaves);
+  auto path = tree.getAuditPath(1);
+
+  // too few siblings
+  auto siblings = path.getSiblings();
+  siblings.pop_back();
+  BOOST_CHECK(!MerkleAuditPath(1, 5, siblings).computeRoot(leaves[1]));
+
+  // too many siblings
+  siblings = path.getSiblings();
+  siblings.push_back(leaves[0]);
+  BOOST_CHECK(!MerkleAuditPath(1, 5, siblings).computeRoot(leaves[1]));
+
+  // leaf index out of range
+  BOOST_CHECK(!MerkleAuditPath(5, 5, path.getSiblings()).computeRoot(leaves[1]));
+
+  // wrong leaf position
+  BOOST_CHECK(MerkleAuditPath(0, 5, path.getSiblings()).computeRoot(leaves[1]) != tree.getRoot());
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  MerkleTree tree(makeLeaves(3));
+  auto path = tree.getAuditPath(1);
+  const Block& wire = path.wireEncode();
+  BOOST_TEST(wire.type() == tlv::security::MerkleAuditPath);
+
+  MerkleAuditPath decoded(wire);
+  BOOST_CHECK(decoded == path);
+  BOOST_TEST(decoded.getSiblings().size() == 2);
+
+  const uint8_t WIRE[] = {
+    0xfd, 0x07, 0x08, 0x2a, // MerkleAuditPath
+      0xfd, 0x07, 0x0a, 0x01, 0x00, // MerkleLeafIndex
+      0xfd, 0x07, 0x0c, 0x01, 0x02, // MerkleLeafCount
+      0xfd, 0x07, 0x0e, 0x1c, // MerkleSibling (wrong length)
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  };
+  BOOST_CHECK_EXCEPTION(MerkleAuditPath(Block(WIRE)), MerkleAuditPath::Error, [] (const auto& e) {
+    return std::string(e.what()).find("must be 32 octets long") != std::string::npos;
+  });
+
+  const uint8_t WIRE_BAD_INDEX[] = {
+    0xfd, 0x07, 0x08, 0x0a, // MerkleAuditPath
+      0xfd, 0x07, 0x0a, 0x01, 0x02, // MerkleLeafIndex
+      0xfd, 0x07, 0x0c, 0x01, 0x02, // MerkleLeafCount
+  };
+  BOOST_CHECK_THROW(MerkleAuditPath(Block(WIRE_BAD_INDEX)), MerkleAuditPath::Error);
+
+  const uint8_t WIRE_NO_COUNT[] = {
+    0xfd, 0x07, 0x08, 0x05, // MerkleAuditPath
+      0xfd, 0x07, 0x0a, 0x01, 0x00, // MerkleLeafIndex
+  };
+  BOOST_CHECK_THROW(MerkleAuditPath(Block(WIRE_NO_COUNT)), MerkleAuditPath::Error);
+}
+
+BOOST_AUTO_TEST_CASE(DataLeaf)
+{
+  const uint8_t SIGNED_PORTION[] = {
+    0x07, 0x03, 0x08, 0x01, 0x41, // Name
+    0x15, 0x02, 0xca, 0xfe, // Content
+    0x16, 0x03, 0x1b, 0x01, 0x00, // SignatureInfo
+  };
+  const uint8_t OTHER_SIG_INFO[] = {
+    0x07, 0x03, 0x08, 0x01, 0x41, // Name
+    0x15, 0x02, 0xca, 0xfe, // Content
+    0x16, 0x03, 0x1b, 0x01, 0x03, // SignatureInfo
+  };
+  const uint8_t OTHER_CONTENT[] = {
+    0x07, 0x03, 0x08, 0x01, 0x41, // Name
+    0x15, 0x02, 0xca, 0xff, // Content
+    0x16, 0x03, 0x1b, 0x01, 0x00, // SignatureInfo
+  };
+
+  auto leaf = MerkleTree::computeDataLeaf(SIGNED_PORTION);
+  // SignatureInfo is not covered by the leaf digest
+  BOOST_CHECK(MerkleTree::computeDataLeaf(OTHER_SIG_INFO) == leaf);
+  BOOST_CHECK(MerkleTree::computeDataLeaf(OTHER_CONTENT) != leaf);
+
+  BOOST_CHECK_THROW(MerkleTree::computeDataLeaf(make_span(SIGNED_PORTION).first(9)), tlv::Error);
+  BOOST_CHECK_THROW(MerkleTree::computeDataLeaf(make_span(SIGNED_PORTION).first(7)), tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMerkleTree
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace ndn::tests
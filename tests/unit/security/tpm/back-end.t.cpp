@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -37,6 +37,8 @@
 
 #include "tests/boost-test.hpp"
 
+#include <filesystem>
+#include <fstream>
 #include <set>
 #include <boost/mp11/list.hpp>
 
@@ -348,6 +350,67 @@ BOOST_AUTO_TEST_CASE(RandomKeyId)
   }
 }
 
+BOOST_AUTO_TEST_CASE(FileKeyCache)
+{
+  const auto tmpPath = std::filesystem::path(UNIT_TESTS_TMPDIR) / "TpmBackEndFileCache";
+  const auto keyDir = tmpPath / "ndnsec-key-file";
+  auto countKeyFiles = [&] {
+    return std::distance(std::filesystem::directory_iterator(keyDir),
+                         std::filesystem::directory_iterator());
+  };
+
+  Name identity("/Test/KeyName");
+  Name keyName = constructKeyName(identity, name::Component("1"));
+  {
+    tpm::BackEndFile backEnd(tmpPath);
+    BOOST_CHECK(backEnd.createKey(identity, EcKeyParams(keyName.at(-1))) != nullptr);
+    BOOST_CHECK_EQUAL(countKeyFiles(), 1);
+
+    // the cached key is used even after its file disappears
+    std::filesystem::remove_all(keyDir);
+    std::filesystem::create_directories(keyDir);
+    BOOST_CHECK(backEnd.hasKey(keyName));
+    auto handle = backEnd.getKeyHandle(keyName);
+    BOOST_REQUIRE(handle != nullptr);
+    const std::array<uint8_t, 3> content{1, 2, 3};
+    BOOST_CHECK(handle->sign(DigestAlgorithm::SHA256, {content}) != nullptr);
+
+    // deletion invalidates the cache
+    backEnd.deleteKey(keyName);
+    BOOST_CHECK_EQUAL(backEnd.hasKey(keyName), false);
+    BOOST_CHECK(backEnd.getKeyHandle(keyName) == nullptr);
+
+    // a freshly imported key is cached as well
+    backEnd.importKey(keyName, transform::generatePrivateKey(EcKeyParams()));
+    BOOST_CHECK_EQUAL(countKeyFiles(), 1);
+    std::filesystem::remove_all(keyDir);
+    std::filesystem::create_directories(keyDir);
+    BOOST_CHECK(backEnd.getKeyHandle(keyName) != nullptr);
+  }
+
+  {
+    // a new instance sees the key directory, and rejects files that cannot be parsed
+    tpm::BackEndFile backEnd(tmpPath);
+    BOOST_CHECK_EQUAL(backEnd.hasKey(keyName), false);
+    backEnd.createKey(identity, EcKeyParams(keyName.at(-1)));
+    auto keyFile = std::filesystem::directory_iterator(keyDir)->path();
+
+    tpm::BackEndFile backEnd2(tmpPath);
+    BOOST_CHECK(backEnd2.hasKey(keyName));
+    std::filesystem::permissions(keyFile, std::filesystem::perms::owner_write,
+                                 std::filesystem::perm_options::add);
+    std::ofstream(keyFile) << "not a key";
+    // the key was loaded by hasKey()
+    BOOST_CHECK(backEnd2.getKeyHandle(keyName) != nullptr);
+
+    tpm::BackEndFile backEnd3(tmpPath);
+    BOOST_CHECK_EQUAL(backEnd3.hasKey(keyName), false);
+    BOOST_CHECK(backEnd3.getKeyHandle(keyName) == nullptr);
+  }
+
+  std::filesystem::remove_all(tmpPath);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestTpmBackEnd
 BOOST_AUTO_TEST_SUITE_END() // Security
 
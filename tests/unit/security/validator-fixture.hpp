@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -158,8 +158,14 @@ public:
   }
 
 private:
+  std::function<bool(const std::optional<Certificate>&)>
+  getOriginalPacketVerifier() const override
+  {
+    return [] (const auto&) { return false; };
+  }
+
   void
-  verifyOriginalPacket(const std::optional<Certificate>&) override
+  finishValidation(bool) override
   {
     // do nothing
   }
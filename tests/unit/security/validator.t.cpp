@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -238,6 +238,68 @@ BOOST_AUTO_TEST_CASE(UntrustedCertCaching)
   BOOST_TEST(face.sentInterests.size() > 1);
 }
 
+BOOST_AUTO_TEST_CASE(AsyncVerification)
+{
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  Data badData(data);
+  const uint8_t sv[] = {0x12, 0x34, 0x56, 0x78};
+  badData.setSignatureValue(sv);
+
+  size_t nSuccesses = 0;
+  size_t nFailures = 0;
+  auto validate = [&] (const Data& d) {
+    validator.validate(d,
+      [&] (const Data&) { ++nSuccesses; },
+      [&] (const Data&, const ValidationError& error) {
+        lastError = error;
+        ++nFailures;
+      });
+  };
+  // A verification on a worker thread holds a work guard on m_io until its result has been
+  // posted, so run_one() blocks until the next result is ready, without real-time delays.
+  auto waitForCallbacks = [&] (size_t n) {
+    while (nSuccesses + nFailures < n) {
+      if (m_io.stopped()) {
+        m_io.restart();
+      }
+      BOOST_TEST_REQUIRE(m_io.run_one() == 1);
+    }
+  };
+
+  validator.enableAsyncVerification(m_io, 2);
+
+  // signing certificate is retrieved from the network
+  validate(data);
+  mockNetworkOperations();
+  waitForCallbacks(1);
+  BOOST_TEST(nSuccesses == 1);
+  BOOST_TEST(face.sentInterests.size() == 1);
+
+  // signing certificate is in the verified certificate cache, callback is still asynchronous
+  validate(data);
+  BOOST_TEST(nSuccesses == 1);
+  waitForCallbacks(2);
+  BOOST_TEST(nSuccesses == 2);
+
+  validate(badData);
+  waitForCallbacks(3);
+  BOOST_TEST(nFailures == 1);
+  BOOST_TEST(lastError.getCode() == ValidationError::INVALID_SIGNATURE);
+
+  // changing the mode abandons verifications in progress
+  validate(data);
+  validator.disableAsyncVerification();
+  waitForCallbacks(4);
+  BOOST_TEST(nFailures == 2);
+  BOOST_TEST(lastError.getCode() == ValidationError::IMPLEMENTATION_ERROR);
+
+  // synchronous again
+  validate(data);
+  BOOST_TEST(nSuccesses == 3);
+  BOOST_TEST(face.sentInterests.size() == 1);
+}
+
 class ValidationPolicySimpleHierarchyForInterestOnly : public ValidationPolicySimpleHierarchy
 {
 public:
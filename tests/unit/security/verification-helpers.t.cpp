@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -591,6 +591,30 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(VerifySignature, Dataset, SignatureDatasets)
   // - pib::Key version is tested in key-chain.t.cpp (Security/TestKeyChain)
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(VerifySignatures, Dataset, SignatureDatasets)
+{
+  const Dataset dataset;
+  Certificate cert(dataset.cert);
+  auto keyRaw = cert.getPublicKey();
+  const uint8_t invalidKey[] = {0x00, 0x00};
+
+  const std::vector<Data> data{Data(dataset.goodData), Data(dataset.badSigData),
+                               Data(dataset.goodData), Data("/some/data")};
+  const std::vector<span<const uint8_t>> dataKeys{keyRaw, keyRaw, invalidKey, keyRaw};
+  BOOST_TEST(verifySignatures(data, dataKeys) == std::vector<bool>({true, false, false, false}),
+             boost::test_tools::per_element());
+
+  const std::vector<Interest> interests{Interest(dataset.goodInterest), Interest(dataset.badSigInterest),
+                                        Interest(dataset.goodInterestOldFormat),
+                                        Interest(dataset.badSigInterestOldFormat)};
+  const std::vector<span<const uint8_t>> interestKeys(interests.size(), keyRaw);
+  BOOST_TEST(verifySignatures(interests, interestKeys) == std::vector<bool>({true, false, true, false}),
+             boost::test_tools::per_element());
+
+  BOOST_TEST(verifySignatures(span<const Data>(), span<const span<const uint8_t>>()).empty());
+  BOOST_CHECK_THROW(std::ignore = verifySignatures(data, span(dataKeys).first(2)), std::invalid_argument);
+}
+
 BOOST_FIXTURE_TEST_CASE(VerifyHmac, KeyChainFixture)
 {
   const Tpm& tpm = m_keyChain.getTpm();
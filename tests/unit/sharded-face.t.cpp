@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/sharded-face.hpp"
+#include "ndn-cxx/lp/fields.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "ndn-cxx/transport/transport.hpp"
+
+#include "tests/key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <set>
+#include <thread>
+
+namespace ndn::tests {
+
+/**
+ * \brief Transport that plays the role of the forwarder, on the I/O thread of a ShardedFace.
+ */
+class ForwarderTransport final : public ndn::Transport
+{
+public:
+  void
+  connect(boost::asio::io_context& ioCtx, ReceiveCallback receiveCallback) final
+  {
+    Transport::connect(ioCtx, std::move(receiveCallback));
+    setState(State::RUNNING);
+    boost::asio::post(ioCtx, [this] { onConnect(); });
+  }
+
+  void
+  close() final
+  {
+    setState(State::CLOSED);
+  }
+
+  void
+  pause() final
+  {
+    isPaused = true;
+  }
+
+  void
+  resume() final
+  {
+    isPaused = false;
+  }
+
+  void
+  send(const Block& wire) final
+  {
+    onSend(wire);
+  }
+
+  void
+  receive(const Block& wire)
+  {
+    m_receiveCallback(wire);
+  }
+
+public:
+  std::function<void()> onConnect;
+  std::function<void(const Block&)> onSend;
+  bool isPaused = true;
+};
+
+class ShardedFaceFixture : public KeyChainFixture
+{
+protected:
+  ShardedFaceFixture()
+    : forwarder(make_shared<ForwarderTransport>())
+    , face(forwarder, m_keyChain, 4)
+  {
+  }
+
+  /**
+   * \brief Run the ShardedFace until shutdown() is called, or until a timeout.
+   */
+  void
+  run()
+  {
+    boost::asio::io_context timerIo;
+    std::thread watchdog([&] {
+      boost::asio::steady_timer timer(timerIo, std::chrono::seconds(10));
+      timer.async_wait([&] (const auto& error) {
+        if (!error) {
+          BOOST_ERROR("ShardedFace did not shut down in time");
+          face.shutdown();
+        }
+      });
+      timerIo.run();
+    });
+    face.run();
+    timerIo.stop();
+    watchdog.join();
+  }
+
+  size_t
+  findShard(const Face& shardFace)
+  {
+    for (size_t i = 0; i < face.getNShards(); ++i) {
+      if (&face.getShard(i) == &shardFace) {
+        return i;
+      }
+    }
+    BOOST_FAIL("unknown shard Face");
+    return 0;
+  }
+
+protected:
+  shared_ptr<ForwarderTransport> forwarder;
+  ShardedFace face;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestShardedFace, ShardedFaceFixture)
+
+BOOST_AUTO_TEST_CASE(SteerInterests)
+{
+  constexpr int N_INTERESTS = 200;
+  BOOST_CHECK_EQUAL(face.getNShards(), 4);
+
+  // each vector is written only by the thread of the corresponding shard
+  std::vector<std::vector<Name>> namesByShard(face.getNShards());
+  face.setInterestFilter("/A", [&] (Face& shardFace, const auto&, const Interest& interest) {
+    namesByShard[findShard(shardFace)].push_back(interest.getName());
+    shardFace.put(*makeData(interest.getName()));
+  });
+
+  forwarder->onConnect = [&] {
+    for (int i = 0; i < N_INTERESTS; ++i) {
+      forwarder->receive(makeInterest(Name("/A").appendNumber(i))->wireEncode());
+    }
+  };
+  std::set<Name> replied;
+  forwarder->onSend = [&] (const Block& wire) {
+    BOOST_REQUIRE_EQUAL(wire.type(), tlv::Data);
+    replied.insert(Data(wire).getName());
+    if (replied.size() == N_INTERESTS) {
+      face.shutdown();
+    }
+  };
+  run();
+
+  BOOST_CHECK_EQUAL(replied.size(), N_INTERESTS);
+  size_t nProcessed = 0;
+  for (size_t i = 0; i < face.getNShards(); ++i) {
+    BOOST_TEST_CONTEXT("Shard " << i) {
+      // shards share the load, and each Interest is processed by the shard of its name
+      BOOST_CHECK(!namesByShard[i].empty());
+      for (const auto& name : namesByShard[i]) {
+        BOOST_CHECK_EQUAL(face.getShardIndex(name), i);
+      }
+    }
+    nProcessed += namesByShard[i].size();
+  }
+  BOOST_CHECK_EQUAL(nProcessed, N_INTERESTS);
+}
+
+BOOST_AUTO_TEST_CASE(ResumeOnConnect)
+{
+  // the shards receive Interests although the I/O Face has nothing pending
+  forwarder->onConnect = [&] {
+    BOOST_CHECK_EQUAL(forwarder->isPaused, false);
+    face.shutdown();
+  };
+  run();
+  BOOST_CHECK_EQUAL(forwarder->isPaused, false);
+}
+
+BOOST_AUTO_TEST_CASE(DataWithPitToken)
+{
+  Face& shard = face.getShard(2);
+  bool hasData = false;
+  shard.expressInterest(*makeInterest("/B", true),
+                        [&] (auto&&...) { hasData = true; face.shutdown(); },
+                        [&] (auto&&...) { BOOST_ERROR("unexpected Nack"); face.shutdown(); },
+                        [&] (auto&&...) { BOOST_ERROR("unexpected timeout"); face.shutdown(); });
+
+  forwarder->onConnect = [] {};
+  forwarder->onSend = [&] (const Block& wire) {
+    // the Interest carries the PIT token of the shard, which is echoed in the Data
+    lp::Packet interestPacket(wire);
+    BOOST_REQUIRE(interestPacket.has<lp::PitTokenField>());
+    auto frag = interestPacket.get<lp::FragmentField>();
+    BOOST_CHECK_EQUAL(Interest(Block(wire, frag.first, frag.second)).getName(), "/B");
+
+    lp::Packet dataPacket;
+    dataPacket.add<lp::PitTokenField>(interestPacket.get<lp::PitTokenField>());
+    Block data = makeData("/B/1")->wireEncode();
+    dataPacket.add<lp::FragmentField>({data.begin(), data.end()});
+    forwarder->receive(dataPacket.wireEncode());
+  };
+  run();
+
+  BOOST_CHECK(hasData);
+}
+
+BOOST_AUTO_TEST_CASE(DataWithoutPitToken)
+{
+  // Data without a PIT token is delivered to every shard, and satisfies the Interest of shard 1
+  Face& shard = face.getShard(1);
+  bool hasData = false;
+  shard.expressInterest(*makeInterest("/C", true),
+                        [&] (auto&&...) { hasData = true; face.shutdown(); },
+                        nullptr, nullptr);
+
+  forwarder->onConnect = [] {};
+  forwarder->onSend = [&] (const Block&) {
+    forwarder->receive(makeData("/C/1")->wireEncode());
+  };
+  run();
+
+  BOOST_CHECK(hasData);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShardedFace
+
+} // namespace ndn::tests
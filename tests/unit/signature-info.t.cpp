@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -299,6 +299,27 @@ BOOST_AUTO_TEST_CASE(EncodeDecode)
   BOOST_CHECK(!info.getSeqNum());
 }
 
+BOOST_AUTO_TEST_CASE(CachedEncoding)
+{
+  SignatureInfo info(tlv::SignatureSha256WithRsa, KeyLocator("/test/key/locator"));
+  const Block wire = info.wireEncode(SignatureInfo::Type::Data);
+
+  // the cached encoding is prepended as is
+  EncodingEstimator estimator;
+  BOOST_CHECK_EQUAL(info.wireEncode(estimator, SignatureInfo::Type::Data), wire.size());
+  EncodingBuffer encoder;
+  BOOST_CHECK_EQUAL(info.wireEncode(encoder, SignatureInfo::Type::Data), wire.size());
+  BOOST_CHECK(encoder.block() == wire);
+
+  // but not if the other type of SignatureInfo is requested
+  const Block interestWire = info.wireEncode(SignatureInfo::Type::Interest);
+  BOOST_CHECK_EQUAL(interestWire.type(), tlv::InterestSignatureInfo);
+  BOOST_TEST(interestWire.value_bytes() == wire.value_bytes(), boost::test_tools::per_element());
+  EncodingBuffer encoder2;
+  info.wireEncode(encoder2, SignatureInfo::Type::Data);
+  BOOST_CHECK(encoder2.block() == wire);
+}
+
 BOOST_AUTO_TEST_CASE(DecodeError)
 {
   const uint8_t error1[] = {
@@ -0,0 +1,275 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/transport/shm-transport.hpp"
+#include "ndn-cxx/transport/detail/shm-channel.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+
+namespace ndn::tests {
+
+BOOST_AUTO_TEST_SUITE(Transport)
+BOOST_AUTO_TEST_SUITE(TestShmTransport)
+
+using ndn::Transport;
+using ndn::detail::ShmChannel;
+
+BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
+{
+  BOOST_CHECK_EQUAL(ShmTransport::getSocketNameFromUri("shm:///tmp/test/nfd-shm.sock"),
+                    "/tmp/test/nfd-shm.sock");
+  BOOST_CHECK_EQUAL(ShmTransport::getSocketNameFromUri(""), "/run/nfd/nfd-shm.sock");
+  BOOST_CHECK_EXCEPTION(ShmTransport::getSocketNameFromUri("unix:///tmp/test/nfd.sock"),
+                        Transport::Error,
+                        [] (const Transport::Error& error) {
+                          return error.what() == "Cannot create ShmTransport from \"unix\" URI"s;
+                        });
+}
+
+BOOST_AUTO_TEST_CASE(Channel)
+{
+  ShmChannel client(MAX_NDN_PACKET_SIZE);
+  ShmChannel forwarder(ShmChannel::Role::FORWARDER, ::dup(client.getMemFd()),
+                       ::dup(client.getClientEventFd()), ::dup(client.getForwarderEventFd()),
+                       client.getRingCapacity());
+
+  BOOST_CHECK_EQUAL(std::get<0>(forwarder.read()), false);
+
+  // elements wrap around the end of the ring
+  Block data = makeData("/A")->wireEncode();
+  size_t nWritten = 0;
+  for (size_t i = 0; i < 3 * MAX_NDN_PACKET_SIZE / data.size(); ++i) {
+    BOOST_REQUIRE(client.write(data));
+    ++nWritten;
+    auto [isOk, element] = forwarder.read();
+    BOOST_REQUIRE(isOk);
+    BOOST_TEST(element == data);
+  }
+
+  // a full ring rejects further elements, until the consumer has caught up
+  while (client.write(data)) {
+    ++nWritten;
+  }
+  BOOST_CHECK_EQUAL(std::get<0>(forwarder.read()), true);
+  forwarder.wakeBlockedPeer();
+  uint64_t nNotifications = 0;
+  BOOST_CHECK_EQUAL(::read(client.getClientEventFd(), &nNotifications, sizeof(nNotifications)),
+                    sizeof(nNotifications));
+  BOOST_CHECK_EQUAL(nNotifications, 1);
+  BOOST_CHECK_EQUAL(client.write(data), true);
+}
+
+class ShmTransportFixture
+{
+protected:
+  ShmTransportFixture()
+  {
+    std::filesystem::create_directories(socketPath.parent_path());
+    std::filesystem::remove(socketPath);
+    acceptor.open();
+    acceptor.bind(socketPath.string());
+    acceptor.listen();
+  }
+
+  ~ShmTransportFixture()
+  {
+    if (transport.getState() != Transport::State::CLOSED) {
+      transport.close();
+    }
+    std::filesystem::remove(socketPath);
+  }
+
+  /**
+   * \brief Connect the transport, and act as the forwarder end of the handshake.
+   */
+  void
+  connect()
+  {
+    acceptor.async_accept(forwarderSocket, [] (const auto& error) { BOOST_REQUIRE(!error); });
+    transport.connect(io, [this] (const Block& element) { received.push_back(element); });
+    while (!forwarderSocket.is_open() || transport.getState() == Transport::State::CONNECTING) {
+      io.run_one();
+    }
+
+    uint8_t payload[16] = {};
+    iovec iov{payload, sizeof(payload)};
+    alignas(cmsghdr) uint8_t control[CMSG_SPACE(3 * sizeof(int))] = {};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    BOOST_REQUIRE_EQUAL(::recvmsg(forwarderSocket.native_handle(), &msg, MSG_DONTWAIT), sizeof(payload));
+    BOOST_REQUIRE_EQUAL(std::memcmp(payload, "NDNSHM\x00\x01", 8), 0);
+    uint64_t ringCapacity = 0;
+    std::memcpy(&ringCapacity, payload + 8, sizeof(ringCapacity));
+    BOOST_CHECK_EQUAL(ringCapacity, ShmChannel::DEFAULT_RING_CAPACITY);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    BOOST_REQUIRE(cmsg != nullptr);
+    BOOST_REQUIRE_EQUAL(cmsg->cmsg_type, SCM_RIGHTS);
+    int fds[3];
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+    forwarder = make_unique<ShmChannel>(ShmChannel::Role::FORWARDER, fds[0], fds[1], fds[2], ringCapacity);
+  }
+
+  /**
+   * \brief Process pending handlers, including the coalesced notification of the forwarder.
+   */
+  void
+  advance()
+  {
+    io.restart();
+    io.poll();
+  }
+
+  /**
+   * \brief Consume all pending notifications on the forwarder's eventfd.
+   * \return whether any notification was pending
+   */
+  bool
+  consumeForwarderNotifications()
+  {
+    uint64_t count = 0;
+    return ::read(forwarder->getOwnEventFd(), &count, sizeof(count)) == sizeof(count);
+  }
+
+  std::vector<Block>
+  readFromForwarder()
+  {
+    std::vector<Block> elements;
+    while (true) {
+      auto [isOk, element] = forwarder->read();
+      if (!isOk) {
+        break;
+      }
+      elements.push_back(element);
+    }
+    forwarder->wakeBlockedPeer();
+    return elements;
+  }
+
+protected:
+  const std::filesystem::path socketPath{std::filesystem::path(UNIT_TESTS_TMPDIR) / "shm-transport.sock"};
+  boost::asio::io_context io;
+  boost::asio::local::stream_protocol::acceptor acceptor{io};
+  boost::asio::local::stream_protocol::socket forwarderSocket{io};
+  ShmTransport transport{socketPath.string()};
+  unique_ptr<ShmChannel> forwarder;
+  std::vector<Block> received;
+};
+
+BOOST_FIXTURE_TEST_CASE(Send, ShmTransportFixture)
+{
+  connect();
+  BOOST_CHECK(transport.getState() == Transport::State::PAUSED);
+
+  std::vector<Block> expected;
+  for (int i = 0; i < 100; ++i) {
+    expected.push_back(makeInterest(Name("/A").appendNumber(i))->wireEncode());
+    transport.send(expected.back());
+  }
+  advance();
+
+  // the whole burst is announced with a single notification
+  uint64_t count = 0;
+  BOOST_CHECK_EQUAL(::read(forwarder->getOwnEventFd(), &count, sizeof(count)), sizeof(count));
+  BOOST_CHECK_EQUAL(count, 1);
+  BOOST_TEST(readFromForwarder() == expected, boost::test_tools::per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(SendFullRing, ShmTransportFixture)
+{
+  connect();
+
+  auto data = makeData("/A");
+  data->setContent(std::vector<uint8_t>(6000, 0xBB));
+  Block wire = data->wireEncode();
+  size_t nBlocks = 3 * ShmChannel::DEFAULT_RING_CAPACITY / wire.size();
+  for (size_t i = 0; i < nBlocks; ++i) {
+    transport.send(wire);
+  }
+  advance();
+
+  // blocks that did not fit into the ring are written after the forwarder has consumed
+  size_t nReceived = 0;
+  for (int i = 0; i < 10 && nReceived < nBlocks; ++i) {
+    BOOST_CHECK(consumeForwarderNotifications());
+    auto elements = readFromForwarder();
+    BOOST_CHECK(!elements.empty());
+    nReceived += elements.size();
+    advance(); // eventfd notification from the forwarder, if the transport was blocked
+    advance();
+  }
+  BOOST_CHECK_EQUAL(nReceived, nBlocks);
+}
+
+BOOST_FIXTURE_TEST_CASE(Receive, ShmTransportFixture)
+{
+  connect();
+
+  Block interest1 = makeInterest("/A")->wireEncode();
+  Block interest2 = makeInterest("/B")->wireEncode();
+  Block interest3 = makeInterest("/C")->wireEncode();
+
+  // elements are not delivered while paused
+  BOOST_REQUIRE(forwarder->write(interest1));
+  forwarder->notifyPeer();
+  advance();
+  BOOST_CHECK_EQUAL(received.size(), 0);
+
+  transport.resume();
+  advance();
+  BOOST_REQUIRE_EQUAL(received.size(), 1);
+  BOOST_TEST(received.at(0) == interest1);
+
+  BOOST_REQUIRE(forwarder->write(interest2));
+  BOOST_REQUIRE(forwarder->write(interest3));
+  forwarder->notifyPeer();
+  advance();
+  BOOST_REQUIRE_EQUAL(received.size(), 3);
+  BOOST_TEST(received.at(1) == interest2);
+  BOOST_TEST(received.at(2) == interest3);
+}
+
+BOOST_FIXTURE_TEST_CASE(ForwarderDisconnect, ShmTransportFixture)
+{
+  connect();
+  transport.resume();
+
+  forwarderSocket.close();
+  BOOST_CHECK_THROW(io.run(), Transport::Error);
+  BOOST_CHECK(transport.getState() == Transport::State::CLOSED);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShmTransport
+BOOST_AUTO_TEST_SUITE_END() // Transport
+
+} // namespace ndn::tests
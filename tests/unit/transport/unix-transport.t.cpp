@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -21,7 +21,13 @@
 
 #include "ndn-cxx/transport/unix-transport.hpp"
 
-#include "tests/boost-test.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <filesystem>
 
 namespace ndn::tests {
 
@@ -50,6 +56,147 @@ BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
                         });
 }
 
+class UnixTransportFixture
+{
+protected:
+  UnixTransportFixture()
+  {
+    std::filesystem::create_directories(socketPath.parent_path());
+    std::filesystem::remove(socketPath);
+    acceptor.open();
+    acceptor.bind(socketPath.string());
+    acceptor.listen();
+  }
+
+  ~UnixTransportFixture()
+  {
+    if (transport.getState() != Transport::State::CLOSED) {
+      transport.close();
+    }
+    std::filesystem::remove(socketPath);
+  }
+
+  void
+  connect()
+  {
+    acceptor.async_accept(serverSocket, [] (const auto& error) { BOOST_REQUIRE(!error); });
+    transport.connect(io, [this] (const Block& element) { received.push_back(element); });
+    while (!serverSocket.is_open() || transport.getState() == Transport::State::CONNECTING) {
+      io.run_one();
+    }
+    transport.resume();
+  }
+
+  void
+  receive(span<const uint8_t> bytes, size_t nExpected)
+  {
+    boost::asio::write(serverSocket, boost::asio::buffer(bytes.data(), bytes.size()));
+    while (received.size() < nExpected) {
+      io.run_one();
+    }
+  }
+
+  std::vector<uint8_t>
+  readFromServerSocket(size_t nBytes)
+  {
+    std::vector<uint8_t> bytes(nBytes);
+    bool isDone = false;
+    boost::asio::async_read(serverSocket, boost::asio::buffer(bytes),
+                            [&] (const auto& error, size_t) {
+                              BOOST_REQUIRE(!error);
+                              isDone = true;
+                            });
+    while (!isDone) {
+      io.run_one();
+    }
+    return bytes;
+  }
+
+protected:
+  const std::filesystem::path socketPath{std::filesystem::path(UNIT_TESTS_TMPDIR) / "unix-transport.sock"};
+  boost::asio::io_context io;
+  boost::asio::local::stream_protocol::acceptor acceptor{io};
+  boost::asio::local::stream_protocol::socket serverSocket{io};
+  UnixTransport transport{socketPath.string()};
+  std::vector<Block> received;
+};
+
+BOOST_FIXTURE_TEST_CASE(Receive, UnixTransportFixture)
+{
+  BOOST_CHECK_EQUAL(transport.isZeroCopyReceiveEnabled(), false);
+  connect();
+
+  Block interest1 = makeInterest("/A")->wireEncode();
+  Block interest2 = makeInterest("/B")->wireEncode();
+  std::vector<uint8_t> bytes(interest1.begin(), interest1.end());
+  bytes.insert(bytes.end(), interest2.begin(), interest2.end());
+
+  receive(make_span(bytes).first(interest1.size() + 2), 1); // second element is incomplete
+  receive(make_span(bytes).subspan(interest1.size() + 2), 2);
+  BOOST_TEST(received.at(0) == interest1);
+  BOOST_TEST(received.at(1) == interest2);
+
+  // each element is copied into its own buffer
+  for (const auto& element : received) {
+    BOOST_CHECK_EQUAL(element.getBuffer()->size(), element.size());
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(ZeroCopyReceive, UnixTransportFixture)
+{
+  transport.setZeroCopyReceive(true);
+  BOOST_CHECK_EQUAL(transport.isZeroCopyReceiveEnabled(), true);
+  connect();
+
+  Block interest1 = makeInterest("/A")->wireEncode();
+  Block interest2 = makeInterest("/B")->wireEncode();
+  Block interest3 = makeInterest("/C")->wireEncode();
+  std::vector<uint8_t> bytes(interest1.begin(), interest1.end());
+  bytes.insert(bytes.end(), interest2.begin(), interest2.end());
+  bytes.insert(bytes.end(), interest3.begin(), interest3.end());
+
+  auto split = interest1.size() + interest2.size() + 2;
+  receive(make_span(bytes).first(split), 2); // third element is incomplete
+  receive(make_span(bytes).subspan(split), 3);
+  BOOST_TEST(received.at(0) == interest1);
+  BOOST_TEST(received.at(1) == interest2);
+  BOOST_TEST(received.at(2) == interest3);
+
+  // all elements share the receive buffer, which is kept alive by the received elements
+  BOOST_CHECK_GT(received.at(0).getBuffer()->size(), bytes.size());
+  BOOST_CHECK(received.at(1).getBuffer() == received.at(0).getBuffer());
+  BOOST_CHECK(received.at(2).getBuffer() == received.at(0).getBuffer());
+}
+
+BOOST_FIXTURE_TEST_CASE(Send, UnixTransportFixture)
+{
+  BOOST_CHECK_EQUAL(transport.getMaxWriteBatchSize(), 0);
+
+  std::vector<uint8_t> expected;
+  auto sendInterests = [&] (int first, int last) {
+    for (int i = first; i < last; ++i) {
+      Block wire = makeInterest(Name("/A").appendNumber(i))->wireEncode();
+      expected.insert(expected.end(), wire.begin(), wire.end());
+      transport.send(wire);
+    }
+  };
+
+  // blocks queued while connecting are written together once connected
+  acceptor.async_accept(serverSocket, [] (const auto& error) { BOOST_REQUIRE(!error); });
+  transport.connect(io, [] (auto&&) {});
+  sendInterests(0, 100);
+  while (!serverSocket.is_open()) {
+    io.run_one();
+  }
+  BOOST_TEST(readFromServerSocket(expected.size()) == expected, boost::test_tools::per_element());
+
+  // a burst of blocks sent while a write is in progress
+  expected.clear();
+  transport.setMaxWriteBatchSize(500);
+  sendInterests(100, 300);
+  BOOST_TEST(readFromServerSocket(expected.size()) == expected, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
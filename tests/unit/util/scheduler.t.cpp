@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -214,6 +214,163 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId,
 
 BOOST_AUTO_TEST_SUITE_END() // General
 
+class TimingWheelFixture : public IoFixture
+{
+protected:
+  Scheduler scheduler{m_io, Scheduler::Backend::TIMING_WHEEL};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TimingWheel, TimingWheelFixture)
+
+BOOST_AUTO_TEST_CASE(Backend)
+{
+  BOOST_CHECK(scheduler.getBackend() == Scheduler::Backend::TIMING_WHEEL);
+  Scheduler defaultScheduler(m_io);
+  BOOST_CHECK(defaultScheduler.getBackend() == Scheduler::Backend::SORTED_QUEUE);
+}
+
+BOOST_AUTO_TEST_CASE(Events)
+{
+  std::vector<int> fired;
+  scheduler.schedule(500_ms, [&] { fired.push_back(500); });
+  EventId eid = scheduler.schedule(1_s, [] { BOOST_ERROR("This event should not have been fired"); });
+  scheduler.schedule(250_ms, [&] { fired.push_back(250); });
+  scheduler.schedule(0_ms, [&] { fired.push_back(0); });
+  eid.cancel();
+  BOOST_CHECK(!eid);
+
+  advanceClocks(1_ms, 249);
+  BOOST_CHECK_EQUAL(fired.size(), 1);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(fired.size(), 2);
+  advanceClocks(25_ms, 1000_ms);
+  BOOST_TEST(fired == std::vector<int>({0, 250, 500}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SubTickOrder)
+{
+  // events that expire within the same tick are executed in order of expiry, then of scheduling
+  std::vector<int> fired;
+  scheduler.schedule(1500_us, [&] { fired.push_back(3); });
+  scheduler.schedule(1100_us, [&] { fired.push_back(1); });
+  scheduler.schedule(1100_us, [&] { fired.push_back(2); });
+  scheduler.schedule(1_ms, [&] { fired.push_back(0); });
+
+  advanceClocks(1_ms);
+  BOOST_TEST(fired == std::vector<int>({0}), boost::test_tools::per_element());
+  advanceClocks(1_ms);
+  BOOST_TEST(fired == std::vector<int>({0, 1, 2, 3}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(LongDelays)
+{
+  // the delays span every level of the wheel, as well as the overflow list
+  const std::vector<time::nanoseconds> delays{63_ms, 64_ms, 4095_ms, 4096_ms, 1_h, 30_days,
+                                              800_days, 2000_days};
+  std::vector<time::steady_clock::time_point> fired(delays.size());
+  auto start = time::steady_clock::now();
+  for (size_t i = 0; i < delays.size(); ++i) {
+    scheduler.schedule(delays[i], [&, i] { fired[i] = time::steady_clock::now(); });
+  }
+
+  auto step = 1_ms;
+  for (size_t i = 0; i < delays.size(); ++i) {
+    // jump close to the expiry (unless already there), then advance in steps of one tick
+    auto gap = start + delays[i] - 5_ms - time::steady_clock::now();
+    if (gap > 0_ns) {
+      advanceClocks(gap);
+    }
+    BOOST_CHECK(fired[i] == time::steady_clock::time_point{});
+    advanceClocks(step, 5);
+    BOOST_CHECK_MESSAGE(fired[i] == start + delays[i], "event " << i << " fired late");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleDuringCallback)
+{
+  int count = 0;
+  std::function<void()> event = [&] {
+    if (++count < 5) {
+      scheduler.schedule(100_ms, event);
+    }
+  };
+  scheduler.schedule(100_ms, event);
+  advanceClocks(10_ms, 1_s);
+  BOOST_CHECK_EQUAL(count, 5);
+}
+
+BOOST_AUTO_TEST_CASE(CancelDuringCallback)
+{
+  EventId eid2;
+  scheduler.schedule(10_ms, [&] { eid2.cancel(); });
+  eid2 = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+  BOOST_CHECK(eid2);
+  advanceClocks(5_ms, 4);
+  BOOST_CHECK(!eid2);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowingCallback)
+{
+  class MyException : public std::exception
+  {
+  };
+  scheduler.schedule(10_ms, [] { throw MyException{}; });
+  bool wasCallbackInvoked = false;
+  scheduler.schedule(10_ms, [&] { wasCallbackInvoked = true; });
+
+  BOOST_CHECK_THROW(advanceClocks(6_ms, 2), MyException);
+  BOOST_CHECK(!wasCallbackInvoked);
+  advanceClocks(1_ms);
+  BOOST_CHECK(wasCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAll)
+{
+  int count = 0;
+  scheduler.schedule(500_ms, [&] { scheduler.cancelAllEvents(); });
+  scheduler.schedule(500_ms, [&] { ++count; });
+  scheduler.schedule(3_s, [&] { ++count; });
+  ScopedEventId eid = scheduler.schedule(10_s, [&] { ++count; });
+
+  advanceClocks(100_ms, 200);
+  BOOST_CHECK_EQUAL(count, 0);
+  BOOST_CHECK(!eid);
+}
+
+BOOST_AUTO_TEST_CASE(ScopedEvent)
+{
+  int count = 0;
+  {
+    ScopedEventId se = scheduler.schedule(10_ms, [&] { ++count; });
+  }
+  ScopedEventId se2 = scheduler.schedule(10_ms, [&] { ++count; });
+  advanceClocks(1_ms, 15);
+  BOOST_CHECK_EQUAL(count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(EventOutlivesScheduler)
+{
+  EventId eid;
+  {
+    Scheduler sched(m_io, Scheduler::Backend::TIMING_WHEEL);
+    eid = sched.schedule(10_ms, [] {});
+    BOOST_CHECK(eid);
+  }
+  BOOST_CHECK(!eid);
+}
+
+BOOST_AUTO_TEST_CASE(IoStopsWhenEmpty)
+{
+  EventId eid = scheduler.schedule(1_h, [] {});
+  eid.cancel();
+  // nothing is pending, therefore the io_context does not block
+  auto start = std::chrono::steady_clock::now();
+  m_io.run_for(std::chrono::seconds(2));
+  BOOST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TimingWheel
+
 BOOST_AUTO_TEST_SUITE(EventId)
 
 using scheduler::EventId;
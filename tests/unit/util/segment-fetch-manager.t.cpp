@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2025 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/segment-fetch-manager.hpp"
+
+#include "ndn-cxx/util/dummy-client-face.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/unit/dummy-validator.hpp"
+#include "tests/unit/io-key-chain-fixture.hpp"
+
+#include <numeric>
+
+namespace ndn::tests {
+
+class SegmentFetchManagerFixture : public IoKeyChainFixture
+{
+protected:
+  shared_ptr<SegmentFetcher>
+  startFetch(const Name& objectName, const Name& producerPrefix)
+  {
+    auto fetcher = manager.start(Interest(objectName), producerPrefix);
+    fetcher->onComplete.connect([this] (ConstBufferPtr data) {
+      BOOST_CHECK_EQUAL(data->size(), N_SEGMENTS * 5);
+      ++nCompletions;
+    });
+    fetcher->onError.connect([] (uint32_t, const std::string& msg) {
+      BOOST_ERROR("unexpected error: " << msg);
+    });
+    return fetcher;
+  }
+
+  /**
+   * @brief Reply to all Interests sent so far, and return their number.
+   */
+  size_t
+  replyToSentInterests()
+  {
+    advanceClocks(1_ms);
+    auto interests = std::move(face.sentInterests);
+    face.sentInterests.clear();
+    for (const auto& interest : interests) {
+      Name dataName = interest.getName();
+      if (!dataName[-1].isSegment()) {
+        dataName.appendVersion(1).appendSegment(0);
+      }
+      auto data = makeData(dataName);
+      data->setContent("Hello"sv);
+      data->setFinalBlock(name::Component::fromSegment(N_SEGMENTS - 1));
+      face.receive(*data);
+    }
+    advanceClocks(1_ms);
+    return interests.size();
+  }
+
+protected:
+  static constexpr uint64_t N_SEGMENTS = 3;
+
+  DummyClientFace face{m_io, m_keyChain};
+  DummyValidator validator;
+  SegmentFetchManager manager{face, validator};
+  int nCompletions = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_FIXTURE_TEST_SUITE(TestSegmentFetchManager, SegmentFetchManagerFixture)
+
+BOOST_AUTO_TEST_CASE(SharedWindow)
+{
+  constexpr int N_OBJECTS = 20;
+  std::vector<shared_ptr<SegmentFetcher>> fetchers;
+  for (int i = 0; i < N_OBJECTS; ++i) {
+    fetchers.push_back(startFetch(Name("/P/obj").appendNumber(i), "/P"));
+  }
+  BOOST_CHECK_EQUAL(manager.getNProducers(), 1);
+
+  // the initial window of one Interest is shared by all objects
+  size_t nInterests = replyToSentInterests();
+  BOOST_CHECK_EQUAL(nInterests, 1);
+
+  // the window grows with every segment, instead of every object starting from one Interest
+  std::vector<size_t> rounds{nInterests};
+  while (nInterests > 0) {
+    nInterests = replyToSentInterests();
+    rounds.push_back(nInterests);
+  }
+  BOOST_CHECK_EQUAL(nCompletions, N_OBJECTS);
+  BOOST_CHECK_EQUAL(std::accumulate(rounds.begin(), rounds.end(), size_t(0)), N_OBJECTS * N_SEGMENTS);
+  BOOST_CHECK_GT(*std::max_element(rounds.begin(), rounds.end()), 8);
+
+  // the state of the congestion controller is reused while a fetcher of the producer exists
+  for (int i = 0; i < 5; ++i) {
+    startFetch(Name("/P/again").appendNumber(i), "/P");
+  }
+  BOOST_CHECK_EQUAL(replyToSentInterests(), 5);
+  while (replyToSentInterests() > 0) {
+  }
+  BOOST_CHECK_EQUAL(nCompletions, N_OBJECTS + 5);
+
+  // the congestion controller is released with the last fetcher
+  fetchers.clear();
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(manager.getNProducers(), 0);
+  startFetch("/P/last", "/P");
+  BOOST_CHECK_EQUAL(manager.getNProducers(), 1);
+  BOOST_CHECK_EQUAL(replyToSentInterests(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Fairness)
+{
+  std::vector<std::pair<uint64_t, Name>> sent; // object number and name of each sent Interest
+  face.onSendInterest.connect([&] (const Interest& interest) {
+    sent.emplace_back(interest.getName()[2].toNumber(), interest.getName());
+  });
+  for (int i = 0; i < 4; ++i) {
+    startFetch(Name("/P/obj").appendNumber(i), "/P");
+  }
+  // every object gets its first segment before any object gets all of its segments
+  while (nCompletions == 0) {
+    BOOST_REQUIRE_GT(replyToSentInterests(), 0);
+  }
+  size_t nStarted = 0;
+  for (const auto& interest : face.sentInterests) {
+    nStarted += interest.getName()[-1].isSegment() ? 0 : 1;
+  }
+  BOOST_CHECK_EQUAL(nStarted, 0); // all discovery Interests were sent before the first completion
+  while (replyToSentInterests() > 0) {
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 4);
+
+  // the fetchers took turns in sending their Interests
+  std::vector<uint64_t> order;
+  std::transform(sent.begin(), sent.end(), std::back_inserter(order), [] (const auto& s) { return s.first; });
+  std::vector<uint64_t> expectedOrder{0, 1, 0, 2, 3, 1, 0, 2, 1, 2, 3, 3};
+  BOOST_TEST(order == expectedOrder, boost::test_tools::per_element());
+
+  // each fetcher sent the discovery Interest, then the Interests of the other segments in order
+  for (uint64_t obj = 0; obj < 4; ++obj) {
+    std::vector<Name> names;
+    for (const auto& [o, name] : sent) {
+      if (o == obj) {
+        names.push_back(name);
+      }
+    }
+    BOOST_TEST_REQUIRE(names.size() == N_SEGMENTS);
+    BOOST_CHECK(!names[0][-1].isSegment());
+    for (uint64_t seg = 1; seg < N_SEGMENTS; ++seg) {
+      BOOST_CHECK_EQUAL(names[seg][-1].toSegment(), seg);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(FirstInterestRetransmission)
+{
+  startFetch("/P/obj1", "/P");
+  startFetch("/P/obj2", "/P");
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(), "/P/obj1");
+  face.sentInterests.clear();
+
+  // after the timeout, the retransmission waits for its turn in the shared window
+  advanceClocks(10_ms, 150);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(), "/P/obj2");
+
+  // the window grows, and the retransmission is sent first
+  BOOST_CHECK_EQUAL(replyToSentInterests(), 1);
+  BOOST_REQUIRE_GE(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.front().getName(), "/P/obj1");
+  while (replyToSentInterests() > 0) {
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 2);
+}
+
+BOOST_AUTO_TEST_CASE(SeparateProducers)
+{
+  startFetch("/P/obj", "/P");
+  startFetch("/Q/obj", "/Q");
+  BOOST_CHECK_EQUAL(manager.getNProducers(), 2);
+
+  // each producer has its own window
+  BOOST_CHECK_EQUAL(replyToSentInterests(), 2);
+  while (replyToSentInterests() > 0) {
+  }
+  BOOST_CHECK_EQUAL(nCompletions, 2);
+}
+
+BOOST_AUTO_TEST_CASE(Stop)
+{
+  auto fetcher1 = startFetch("/P/obj1", "/P");
+  auto fetcher2 = startFetch("/P/obj2", "/P");
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(), "/P/obj1");
+
+  // the stopped fetcher gives its share of the window to the other one
+  fetcher1->stop();
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face.sentInterests.back().getName(), "/P/obj2");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSegmentFetchManager
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace ndn::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2024 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -23,12 +23,16 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/lp/nack.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
 #include "ndn-cxx/util/dummy-client-face.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/unit/dummy-validator.hpp"
 #include "tests/unit/io-key-chain-fixture.hpp"
 
+#include <cstdio>
 #include <set>
 
 namespace ndn::tests {
@@ -48,6 +52,12 @@ public:
     return data;
   }
 
+  static std::string_view
+  asString(span<const uint8_t> bytes)
+  {
+    return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+  }
+
   void
   onError(uint32_t errorCode)
   {
@@ -90,6 +100,7 @@ public:
     fetcher->onInOrderData.connect(std::bind(&SegmentFetcherFixture::onInOrderData, this, _1));
     fetcher->onInOrderComplete.connect(std::bind(&SegmentFetcherFixture::onInOrderComplete, this));
     fetcher->onComplete.connect(std::bind(&SegmentFetcherFixture::onComplete, this, _1));
+    fetcher->onSinkComplete.connect([this] { ++nCompletions; });
     fetcher->onError.connect(std::bind(&SegmentFetcherFixture::onError, this, _1));
 
     fetcher->afterSegmentReceived.connect([this] (const auto&) { ++this->nAfterSegmentReceived; });
@@ -98,6 +109,33 @@ public:
     fetcher->afterSegmentTimedOut.connect([this] { ++nAfterSegmentTimedOut; });
   }
 
+  void
+  signSegment(Data& data)
+  {
+    if (!segmentSigningInfo) {
+      return;
+    }
+    m_keyChain.sign(data, *segmentSigningInfo);
+    if (data.getName()[-1].toSegment() == segmentWithBadSignature) {
+      auto sigValue = data.getSignatureValue();
+      std::vector<uint8_t> badSig(sigValue.value_begin(), sigValue.value_end());
+      badSig.back() ^= 0xFF;
+      data.setSignatureValue(make_shared<Buffer>(badSig.begin(), badSig.end()));
+    }
+  }
+
+  /**
+   * @brief Run the io_context until the retrieval ends, including verifications in worker threads.
+   */
+  void
+  runUntilDone()
+  {
+    for (int i = 0; i < 200 && nCompletions + nErrors == 0; ++i) {
+      m_io.restart();
+      m_io.run_for(std::chrono::milliseconds(50));
+    }
+  }
+
   void
   onInterest(const Interest& interest)
   {
@@ -115,6 +153,7 @@ public:
       auto data = makeDataSegment("/hello/world/version0",
                                   interest.getName().get(-1).toSegment(),
                                   interest.getName().get(-1).toSegment() == nSegments - 1);
+      signSegment(*data);
       face.receive(*data);
 
       uniqSegmentsSent.insert(interest.getName().get(-1).toSegment());
@@ -134,6 +173,7 @@ public:
       }
 
       auto data = makeDataSegment("/hello/world/version0", defaultSegmentToSend, nSegments == 1);
+      signSegment(*data);
       face.receive(*data);
       uniqSegmentsSent.insert(defaultSegmentToSend);
     }
@@ -161,6 +201,9 @@ public:
   lp::NackReason nackReason = lp::NackReason::NONE;
   // segment that is sent in response to an Interest w/o a segment component in its name
   uint64_t defaultSegmentToSend = 0;
+  // if set, segments are signed with this SigningInfo
+  std::optional<security::SigningInfo> segmentSigningInfo;
+  std::optional<uint64_t> segmentWithBadSignature;
 };
 
 BOOST_AUTO_TEST_SUITE(Util)
@@ -173,6 +216,20 @@ BOOST_AUTO_TEST_CASE(InvalidOptions)
   DummyValidator acceptValidator;
   BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
                     std::invalid_argument);
+
+  options.mdCoef = 0.5;
+  options.flowControlWindow = 0;
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
+
+  options.flowControlWindow = 1;
+  options.inOrder = true;
+  options.sink = [] (auto&&...) {};
+  BOOST_CHECK_THROW(SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options),
+                    std::invalid_argument);
+
+  BOOST_CHECK_THROW(SegmentFetcher::makeFileSink(1, 0), std::invalid_argument);
+  BOOST_CHECK_THROW(SegmentFetcher::makeMemorySink({}, 0), std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_CASE(BasicSingleSegment)
@@ -456,6 +513,109 @@ BOOST_AUTO_TEST_CASE(FirstSegmentNotZeroInOrder)
   BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
 }
 
+BOOST_AUTO_TEST_CASE(Sink)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  std::vector<uint64_t> sunk;
+  options.sink = [&] (uint64_t segmentNo, span<const uint8_t> content) {
+    BOOST_CHECK_EQUAL(asString(content), "Hello, world!\0"sv);
+    sunk.push_back(segmentNo);
+  };
+  nSegments = 401;
+  sendNackInsteadOfDropping = false;
+  defaultSegmentToSend = 47;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(dataSize, 0);
+  BOOST_CHECK_EQUAL(nAfterSegmentReceived, 401);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 401);
+  BOOST_CHECK_EQUAL(fetcher->m_segmentBuffer.size(), 0);
+  // each segment is consumed once, in arrival order
+  BOOST_REQUIRE_EQUAL(sunk.size(), 401);
+  BOOST_CHECK_EQUAL(sunk.front(), 47);
+  std::sort(sunk.begin(), sunk.end());
+  BOOST_CHECK(std::adjacent_find(sunk.begin(), sunk.end()) == sunk.end());
+}
+
+BOOST_AUTO_TEST_CASE(MemorySink)
+{
+  DummyValidator acceptValidator;
+  std::vector<uint8_t> region(14 * 20 + 5);
+  SegmentFetcher::Options options;
+  options.sink = SegmentFetcher::makeMemorySink(region, 14);
+  nSegments = 20;
+  sendNackInsteadOfDropping = false;
+  defaultSegmentToSend = 7;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  for (size_t i = 0; i < 20; ++i) {
+    BOOST_CHECK_EQUAL(asString(make_span(region).subspan(i * 14, 14)), "Hello, world!\0"sv);
+  }
+  BOOST_CHECK_EQUAL(std::count(region.begin() + 14 * 20, region.end(), 0), 5);
+}
+
+BOOST_AUTO_TEST_CASE(FileSink)
+{
+  DummyValidator acceptValidator;
+  std::unique_ptr<std::FILE, decltype(&std::fclose)> file(std::tmpfile(), &std::fclose);
+  BOOST_REQUIRE(file != nullptr);
+  SegmentFetcher::Options options;
+  options.sink = SegmentFetcher::makeFileSink(fileno(file.get()), 14);
+  nSegments = 20;
+  sendNackInsteadOfDropping = false;
+  defaultSegmentToSend = 7;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  std::vector<char> contents(14 * 20 + 1);
+  std::rewind(file.get());
+  BOOST_REQUIRE_EQUAL(std::fread(contents.data(), 1, contents.size(), file.get()), 14 * 20);
+  for (size_t i = 0; i < 20; ++i) {
+    BOOST_CHECK_EQUAL(std::string_view(contents.data() + i * 14, 14), "Hello, world!\0"sv);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SinkFailure)
+{
+  DummyValidator acceptValidator;
+  std::vector<uint8_t> region(14 * 3);
+  SegmentFetcher::Options options;
+  options.sink = SegmentFetcher::makeMemorySink(region, 14);
+  nSegments = 401;
+  sendNackInsteadOfDropping = false;
+
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  face.processEvents(1_s);
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::SINK_ERROR));
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+}
+
 BOOST_AUTO_TEST_CASE(WindowSize)
 {
   DummyValidator acceptValidator;
@@ -776,6 +936,134 @@ BOOST_AUTO_TEST_CASE(ValidationFailure)
   BOOST_CHECK_EQUAL(nErrors, 1);
 }
 
+class ParallelValidationFixture : public SegmentFetcherFixture
+{
+protected:
+  ParallelValidationFixture()
+  {
+    auto identity = m_keyChain.createIdentity("/hello");
+    validator.loadAnchor("", Certificate(identity.getDefaultKey().getDefaultCertificate()));
+    segmentSigningInfo = signingByIdentity(identity);
+    validator.enableAsyncVerification(m_io, 2);
+    nSegments = 200;
+  }
+
+protected:
+  security::Validator validator{make_unique<security::ValidationPolicySimpleHierarchy>(),
+                                make_unique<security::CertificateFetcherOffline>()};
+};
+
+BOOST_FIXTURE_TEST_CASE(ParallelValidation, ParallelValidationFixture)
+{
+  std::vector<uint64_t> validated;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), validator);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+  fetcher->afterSegmentValidated.connect([&] (const Data& data) {
+    validated.push_back(data.getName()[-1].toSegment());
+  });
+
+  runUntilDone();
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(dataSize, 14 * 200);
+  BOOST_CHECK_EQUAL(nAfterSegmentReceived, 200);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 200);
+  BOOST_CHECK(fetcher->m_pendingValidations.empty());
+  // results are applied in the order of receipt, which is the segment order here
+  BOOST_CHECK(std::is_sorted(validated.begin(), validated.end()));
+}
+
+BOOST_FIXTURE_TEST_CASE(ParallelValidationFailure, ParallelValidationFixture)
+{
+  segmentWithBadSignature = 150;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), validator);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  runUntilDone();
+
+  BOOST_CHECK_EQUAL(nErrors, 1);
+  BOOST_CHECK_EQUAL(lastError, static_cast<uint32_t>(SegmentFetcher::SEGMENT_VALIDATION_FAIL));
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 150);
+}
+
+/**
+ * @brief A validation policy that holds back its decisions until they are released.
+ */
+class DeferredValidationPolicy : public security::ValidationPolicy
+{
+public:
+  void
+  acceptAll()
+  {
+    auto pending = std::move(m_pending);
+    m_pending.clear();
+    for (const auto& accept : pending) {
+      accept();
+    }
+  }
+
+  size_t
+  getNPending() const
+  {
+    return m_pending.size();
+  }
+
+protected:
+  void
+  checkPolicy(const Data&, const shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) override
+  {
+    m_pending.push_back([=] { continueValidation(nullptr, state); });
+  }
+
+  void
+  checkPolicy(const Interest&, const shared_ptr<security::ValidationState>& state,
+              const ValidationContinuation& continueValidation) override
+  {
+    m_pending.push_back([=] { continueValidation(nullptr, state); });
+  }
+
+private:
+  std::vector<std::function<void()>> m_pending;
+};
+
+BOOST_AUTO_TEST_CASE(PendingValidationsInFlowControlWindow)
+{
+  auto policy = make_unique<DeferredValidationPolicy>();
+  auto& deferred = *policy;
+  security::Validator validator(std::move(policy), make_unique<security::CertificateFetcherOffline>());
+  nSegments = 20;
+  SegmentFetcher::Options options;
+  options.initCwnd = 10.0;
+  options.flowControlWindow = 4;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), validator, options);
+  face.onSendInterest.connect(std::bind(&SegmentFetcherFixture::onInterest, this, _1));
+  connectSignals(fetcher);
+
+  // the segments waiting for validation fill the window, and no more Interests are sent
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 4);
+  BOOST_CHECK_EQUAL(fetcher->m_pendingValidations.size(), 4);
+  BOOST_CHECK_EQUAL(deferred.getNPending(), 4);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 0);
+
+  while (nCompletions + nErrors == 0 && deferred.getNPending() > 0) {
+    deferred.acceptAll();
+    advanceClocks(10_ms, 10);
+    BOOST_CHECK_LE(fetcher->m_pendingValidations.size() + static_cast<size_t>(fetcher->m_nSegmentsInFlight),
+                   options.flowControlWindow);
+  }
+
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 1);
+  BOOST_CHECK_EQUAL(nAfterSegmentValidated, 20);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 20);
+}
+
 BOOST_AUTO_TEST_CASE(Stop)
 {
   DummyValidator acceptValidator;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2023 Regents of the University of California.
+ * Copyright (c) 2013-2025 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -20,6 +20,9 @@
  */
 
 #include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/encoding/tlv-security.hpp"
+#include "ndn-cxx/security/merkle-tree.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 
 #include "tests/boost-test.hpp"
 #include "tests/key-chain-fixture.hpp"
@@ -137,6 +140,111 @@ BOOST_AUTO_TEST_CASE(MultipleSegments)
   check(segmenter.segment(ss, "/many", 42, 30_s));
 }
 
+BOOST_AUTO_TEST_CASE(Streaming)
+{
+  auto key = m_keyChain.createIdentity("/signer").getDefaultKey();
+  Segmenter segmenter(m_keyChain, security::signingByKey(key), 2);
+
+  std::vector<std::shared_ptr<Data>> v;
+  auto onSegment = [&] (auto data) { v.push_back(std::move(data)); };
+
+  std::istringstream ss(std::string(reinterpret_cast<const char*>(BLOB), sizeof(BLOB)));
+  BOOST_TEST(segmenter.segment(ss, "/stream", 42, 30_s, onSegment) == 8);
+  BOOST_REQUIRE_EQUAL(v.size(), 8);
+  for (size_t segNo = 0; segNo < v.size(); ++segNo) {
+    BOOST_TEST(v[segNo]->getName() == Name("/stream").appendSegment(segNo));
+    BOOST_TEST(v[segNo]->getFreshnessPeriod() == 30_s);
+    // the number of segments is unknown until the end of the stream
+    BOOST_TEST(v[segNo]->getFinalBlock().has_value() == (segNo == 7));
+    BOOST_TEST(v[segNo]->getSignatureInfo().getSignatureType() == tlv::SignatureSha256WithEcdsa);
+    BOOST_TEST(security::verifySignature(*v[segNo], key));
+  }
+  BOOST_TEST(v.back()->getFinalBlock().value() == name::Component::fromSegment(7));
+
+  v.clear();
+  std::istringstream empty;
+  BOOST_TEST(segmenter.segment(empty, "/empty", 42, 1_s, onSegment, tlv::ContentType_Nack) == 1);
+  BOOST_REQUIRE_EQUAL(v.size(), 1);
+  BOOST_TEST(v[0]->getContentType() == tlv::ContentType_Nack);
+  BOOST_TEST(v[0]->getFinalBlock().value() == name::Component::fromSegment(0));
+
+  v.clear();
+  BOOST_TEST(segmenter.segment(BLOB, "/blob", 100, 1_s, onSegment) == 3);
+  BOOST_REQUIRE_EQUAL(v.size(), 3);
+  BOOST_TEST(v[0]->getFinalBlock().value() == name::Component::fromSegment(2));
+
+  std::istringstream ss2("foo");
+  BOOST_CHECK_THROW(segmenter.segment(ss2, "/foo", 0, 1_s, onSegment), std::invalid_argument);
+  BOOST_CHECK_THROW(segmenter.segment(BLOB, "/foo", 0, 1_s, onSegment), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelSigning)
+{
+  auto key = m_keyChain.createIdentity("/signer").getDefaultKey();
+  Segmenter segmenter(m_keyChain, security::signingByKey(key), 4);
+
+  auto check = [&] (const auto& v, const Name& prefix, bool isStreaming) {
+    BOOST_REQUIRE_EQUAL(v.size(), 30);
+    for (size_t segNo = 0; segNo < v.size(); ++segNo) {
+      BOOST_TEST(v[segNo]->getName() == Name(prefix).appendSegment(segNo));
+      BOOST_TEST(v[segNo]->getContent().value_bytes() == make_span(BLOB).subspan(segNo * 10, 10),
+                 boost::test_tools::per_element());
+      BOOST_TEST(v[segNo]->getFinalBlock().has_value() == (!isStreaming || segNo == 29));
+      BOOST_TEST(security::verifySignature(*v[segNo], key));
+    }
+  };
+
+  check(segmenter.segment(BLOB, "/vec", 10, 1_s), "/vec", false);
+  std::istringstream ss1(std::string(reinterpret_cast<const char*>(BLOB), sizeof(BLOB)));
+  check(segmenter.segment(ss1, "/vec", 10, 1_s), "/vec", false);
+
+  std::vector<std::shared_ptr<Data>> v;
+  std::istringstream ss2(std::string(reinterpret_cast<const char*>(BLOB), sizeof(BLOB)));
+  segmenter.segment(ss2, "/stream", 10, 1_s, [&] (auto data) { v.push_back(std::move(data)); });
+  check(v, "/stream", true);
+
+  // an exception thrown by the callback is propagated to the caller
+  std::istringstream ss3(std::string(reinterpret_cast<const char*>(BLOB), sizeof(BLOB)));
+  size_t nReceived = 0;
+  BOOST_CHECK_THROW(segmenter.segment(ss3, "/stream", 10, 1_s, [&] (auto&&) {
+                      if (++nReceived == 5) {
+                        NDN_THROW(std::runtime_error("sink is full"));
+                      }
+                    }),
+                    std::runtime_error);
+  BOOST_TEST(nReceived == 5);
+}
+
+BOOST_AUTO_TEST_CASE(BatchSigning)
+{
+  auto key = m_keyChain.createIdentity("/signer").getDefaultKey();
+
+  for (size_t nThreads : {0, 2}) {
+    BOOST_TEST_CONTEXT("nThreads=" << nThreads) {
+      Segmenter segmenter(m_keyChain, security::signingByKey(key), nThreads);
+      segmenter.setSigningBatchSize(8);
+
+      std::vector<std::shared_ptr<Data>> v;
+      std::istringstream ss(std::string(reinterpret_cast<const char*>(BLOB), sizeof(BLOB)));
+      auto n = segmenter.segment(ss, "/batch", 10, 1_s, [&] (auto data) { v.push_back(std::move(data)); });
+      BOOST_TEST(n == 30);
+      BOOST_REQUIRE_EQUAL(v.size(), 30);
+
+      for (size_t segNo = 0; segNo < v.size(); ++segNo) {
+        BOOST_TEST(v[segNo]->getName() == Name("/batch").appendSegment(segNo));
+        security::MerkleAuditPath path(v[segNo]->getSignatureInfo()
+                                         .getCustomTlv(tlv::security::MerkleAuditPath).value());
+        BOOST_TEST(path.getLeafIndex() == segNo % 8);
+        // the last batch contains the remaining 6 segments
+        BOOST_TEST(path.getLeafCount() == (segNo < 24 ? 8 : 6));
+        // segments of the same batch share a signature
+        BOOST_TEST(v[segNo]->getSignatureValue() == v[segNo - segNo % 8]->getSignatureValue());
+        BOOST_TEST(security::verifySignature(*v[segNo], key));
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestSegmenter
 BOOST_AUTO_TEST_SUITE_END() // Util
 